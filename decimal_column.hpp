@@ -0,0 +1,266 @@
+#pragma once
+
+#include <cstdint>     // uint64_t
+#include <cstddef>     // std::size_t
+#include <cstring>     // std::memcpy
+#include <bit>         // std::endian, std::countr_zero
+#include <span>        // std::span
+#include <string_view> // std::string_view
+#include <charconv>    // std::to_chars_result
+#include <algorithm>   // std::copy, std::copy_backward
+
+#if defined(__SSE2__)
+#include <emmintrin.h> // _mm_loadu_si128
+#endif
+
+#include "u128.hpp"
+
+/**
+ * Пакетный ввод/вывод столбцов десятичных 128-битных чисел: текст вида "123\n-45\n..." или "1,2,3".
+ */
+namespace u128
+{
+    namespace column_detail
+    {
+        // Поле столбца для NaN: пустое поле пропускалось бы при разборе.
+        static constexpr std::string_view NAN_FIELD = "nan";
+
+        // Степени десяти до 10^18: множители для порций цифр.
+        static constexpr ULOW POW10[19]{1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+                                        10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+                                        100000000000ull, 1000000000000ull, 10000000000000ull,
+                                        100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+                                        100000000000000000ull, 1000000000000000000ull};
+
+        inline bool is_delimiter(char c)
+        {
+            return c == '\n' || c == ',' || c == '\r' || c == ' ' || c == '\t';
+        }
+
+        /**
+         * @brief Восемь символов, прочитанных как 64-битное слово (младший байт - первый символ).
+         */
+        inline uint64_t load8(const char *p)
+        {
+            uint64_t v;
+            std::memcpy(&v, p, sizeof(v));
+            if constexpr (std::endian::native == std::endian::big)
+            {
+                v = __builtin_bswap64(v);
+            }
+            return v;
+        }
+
+        /**
+         * @brief SWAR-перевод восьми десятичных цифр в число: три умножения вместо восьми.
+         */
+        inline ULOW parse_eight_digits(uint64_t v)
+        {
+            constexpr uint64_t mask = 0x000000FF000000FFull;
+            constexpr uint64_t mul1 = 100 + (1000000ull << 32);
+            constexpr uint64_t mul2 = 1 + (10000ull << 32);
+            v -= 0x3030303030303030ull;
+            v = v * 10 + (v >> 8);
+            v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+            return static_cast<uint32_t>(v);
+        }
+
+        /**
+         * @brief Конец последовательности десятичных цифр, начинающейся с p.
+         * @details По 16 символов за шаг (SSE2), хвост - посимвольно.
+         */
+        inline const char *skip_digits(const char *p, const char *last)
+        {
+#if defined(__SSE2__)
+            const __m128i shift = _mm_set1_epi8(static_cast<char>(128 - '0'));
+            const __m128i nine = _mm_set1_epi8(static_cast<char>(-128 + 9));
+            while (last - p >= 16)
+            {
+                // После сдвига цифры - это ровно [-128, -119] в знаковых байтах.
+                const __m128i v = _mm_add_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), shift);
+                const unsigned mask = _mm_movemask_epi8(_mm_cmpgt_epi8(v, nine));
+                if (mask != 0)
+                {
+                    return p + std::countr_zero(mask);
+                }
+                p += 16;
+            }
+#endif
+            while (p != last && static_cast<unsigned char>(*p - '0') < 10)
+            {
+                ++p;
+            }
+            return p;
+        }
+
+        /**
+         * @brief Не более 19 десятичных цифр [first, last) в 64-битное число: по 8 цифр за SWAR-шаг.
+         * @details Неполная первая группа читается тоже за один шаг, дополнением ведущими нулями,
+         * если до end есть 8 символов.
+         */
+        inline ULOW parse_short(const char *first, const char *last, const char *end)
+        {
+            ULOW result = 0;
+            std::ptrdiff_t head = (last - first) % 8;
+            if (head != 0 && end - first >= 8)
+            {
+                const int drop = 8 * (8 - head);
+                result = parse_eight_digits((load8(first) << drop) | (0x3030303030303030ull >> (64 - drop)));
+                first += head;
+            }
+            else
+            {
+                for (; head > 0; --head, ++first)
+                {
+                    result = result * 10 + (*first - '0');
+                }
+            }
+            for (; first != last; first += 8)
+            {
+                result = result * POW10[8] + parse_eight_digits(load8(first));
+            }
+            return result;
+        }
+
+        /**
+         * @brief Число из десятичных цифр [first, last); end - конец буфера.
+         * @details До 38 цифр: две 64-битные части по 19 цифр и одно умножение 64x64; длиннее - порциями по 19.
+         * @return false при переполнении.
+         */
+        inline bool parse_digits(const char *first, const char *last, const char *end, U128 &x)
+        {
+            const std::ptrdiff_t n = last - first;
+            if (n <= CHUNK_DIGITS)
+            {
+                x = U128{parse_short(first, last, end)};
+                return true;
+            }
+            if (n <= 2 * CHUNK_DIGITS)
+            {
+                const char *const middle = last - CHUNK_DIGITS;
+                x = U128::mult64(parse_short(first, middle, end), CHUNK_BASE);
+                const ULOW low = parse_short(middle, last, end);
+                x.mLow += low;
+                x.mHigh += x.mLow < low;
+                return true;
+            }
+            ULOW carry = 0;
+            const char *p = first;
+            for (std::ptrdiff_t head = n % CHUNK_DIGITS; p != last; head = CHUNK_DIGITS)
+            {
+                if (head == 0)
+                {
+                    continue;
+                }
+                carry |= U128::mul_add_short(x, head == CHUNK_DIGITS ? CHUNK_BASE : POW10[head], parse_short(p, p + head, end));
+                p += head;
+            }
+            return carry == 0;
+        }
+
+        /**
+         * @brief Десятичная запись несингулярного числа, справа налево от end.
+         * @details Порции по 19 цифр отделяются, только пока число не умещается в 64 бита.
+         * @return Начало записи.
+         */
+        inline char *format_backward(const U128 &x, char *end)
+        {
+            char *p = end;
+            U128 q = x;
+            while (q.mHigh != 0)
+            {
+                p = write_digits_backward(U128::short_divmod(q, CHUNK_BASE), p, CHUNK_DIGITS);
+            }
+            p = write_digits_backward(q.mLow, p);
+            if (x.is_negative())
+            {
+                *--p = '-';
+            }
+            return p;
+        }
+    }
+
+    /**
+     * @brief Разбирает столбец десятичных чисел из buffer в out.
+     * @details Числа разделяются символами '\n', "\r\n", ',', пробелом или табуляцией; пустые поля пропускаются.
+     * Допускается ведущий минус. Поле "inf" или слишком большое число дает переполнение,
+     * поле "nan" или поле с посторонними символами - NaN.
+     * Длина последовательности цифр находится по 16 символов за шаг (SSE2), перевод - по 8 цифр (SWAR).
+     * @return Количество записанных в out чисел; разбор останавливается, когда out заполнен.
+     */
+    inline std::size_t parse_decimal_column(std::string_view buffer, std::span<U128> out)
+    {
+        using namespace column_detail;
+        const char *p = buffer.data();
+        const char *const last = p + buffer.size();
+        std::size_t n = 0;
+        while (n < out.size())
+        {
+            while (p != last && is_delimiter(*p))
+            {
+                ++p;
+            }
+            if (p == last)
+            {
+                break;
+            }
+            const bool negative = *p == '-';
+            p += negative;
+            const char *const digits = p;
+            p = skip_digits(p, last);
+            U128 x{0};
+            if (p == digits || (p != last && !is_delimiter(*p)))
+            {
+                while (p != last && !is_delimiter(*p))
+                {
+                    ++p;
+                }
+                if (std::string_view(digits, p - digits) == INF)
+                {
+                    x.set_overflow();
+                }
+                else
+                {
+                    x.set_nan();
+                }
+            }
+            else if (!parse_digits(digits, p, last, x))
+            {
+                x = U128{0};
+                x.set_overflow();
+            }
+            else
+            {
+                x.mSign = negative && !x.is_zero();
+            }
+            out[n++] = x;
+        }
+        return n;
+    }
+
+    /**
+     * @brief Записывает числа в [first, last) в десятичном виде, завершая каждое символом delimiter.
+     * @details Переполнение записывается как "inf", NaN - как "nan": запись читается обратно parse_decimal_column.
+     * @return {конец записи, errc{}} или {last, errc::value_too_large}, если не хватает места.
+     */
+    inline std::to_chars_result format_decimal_column(std::span<const U128> values, char *first, char *last,
+                                                      char delimiter = '\n')
+    {
+        char *p = first;
+        for (const U128 &x : values)
+        {
+            char buffer[48];
+            char *const end = buffer + sizeof(buffer);
+            const std::string_view special = x.is_overflow() ? INF : column_detail::NAN_FIELD;
+            char *const start = x.is_singular() ? std::copy_backward(special.begin(), special.end(), end)
+                                                : column_detail::format_backward(x, end);
+            if (last - p <= end - start)
+            {
+                return {last, std::errc::value_too_large};
+            }
+            p = std::copy(start, end, p);
+            *p++ = delimiter;
+        }
+        return {p, std::errc{}};
+    }
+}
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <bit>     // std::countl_zero
+#include <utility> // std::pair
+#include <cassert> // assert
+
+#include "u128.hpp"
+#include "gnumber.hpp"
+
+namespace u128
+{
+    /**
+     * Тип двойной ширины для T и битовая ширина T.
+     */
+    template <typename T>
+    struct Widen;
+
+    template <>
+    struct Widen<U128>
+    {
+        using type = GNumber<U128, 64>;
+        static constexpr unsigned int bits = 128;
+    };
+
+    template <typename L, unsigned int H>
+    struct Widen<GNumber<L, H>>
+    {
+        using type = GNumber<GNumber<L, H>, 2 * H>;
+        static constexpr unsigned int bits = 4 * H;
+    };
+
+    /**
+     * Делитель с предвычисленной обратной величиной для многократного деления на одно и то же число.
+     * Деление выполняется умножением на "магическое" число и сдвигами (Granlund, Montgomery, 1994):
+     * m = floor(2^W * (2^l - d) / d) + 1, l = ceil(log2(d)),
+     * q = (t + ((n - t) >> 1)) >> (l - 1), t = mulhi(m, n).
+     * Подходит для U128 и любой ширины GNumber.
+     * Семантика совпадает с оператором деления: частное округляется вниз, остаток неотрицателен.
+     */
+    template <typename T>
+    class Divisor
+    {
+    public:
+        using Wide = typename Widen<T>::type;
+        static constexpr unsigned int W = Widen<T>::bits;
+
+        explicit Divisor(const T &d)
+            : mDivisor{d.abs()}, mSign{d.mSign()}
+        {
+            assert(!d.is_zero() && !d.is_singular());
+            const unsigned int l = bit_width(T::sub_mod(mDivisor, T{1}));
+            mShift1 = l < 1 ? l : 1;
+            mShift2 = l > 1 ? l - 1 : 0;
+            mIsPowerOfTwo = static_cast<unsigned int>(bit_width(mDivisor)) != l;
+            const T delta = l == W ? T::neg_mod(mDivisor) : T::sub_mod(T{1} << l, mDivisor); // 2^l - d.
+            const Wide numerator{T{0}, delta};
+            mMagic = T::add_mod((numerator / mDivisor).first.mLow, T{1});
+        }
+
+        /**
+         * @brief Делитель.
+         */
+        T divisor() const
+        {
+            T result = mDivisor;
+            result.mSign = mSign;
+            return result;
+        }
+
+        /**
+         * @brief Частное и остаток от деления.
+         */
+        std::pair<T, T> divmod(const T &x) const
+        {
+            if (x.is_singular())
+                return std::make_pair(x, T{0});
+            const T n = x.abs();
+            const T t = T::mulhi(mMagic, n);
+            T q = (t + ((n - t) >> mShift1)) >> mShift2;
+            T r = T::sub_mod(n, T::mult_mod(q, mDivisor));
+            const bool make_sign_inverse = x.mSign() != mSign;
+            if (make_sign_inverse && !r.is_zero())
+            {
+                q.inc();
+                r = mDivisor - r;
+            }
+            q.mSign = make_sign_inverse;
+            return std::make_pair(q, r);
+        }
+
+        /**
+         * @brief Частное от деления.
+         */
+        T div(const T &x) const
+        {
+            return divmod(x).first;
+        }
+
+        /**
+         * @brief Остаток от деления.
+         */
+        T mod(const T &x) const
+        {
+            return divmod(x).second;
+        }
+
+        /**
+         * @brief Делится ли число на делитель без остатка.
+         */
+        bool divides(const T &x) const
+        {
+            if (mIsPowerOfTwo)
+                return (x.abs() & T::sub_mod(mDivisor, T{1})).is_zero();
+            return mod(x).is_zero();
+        }
+
+    private:
+        T mDivisor;
+        bool mSign;
+        T mMagic{0};
+        unsigned int mShift1 = 0;
+        unsigned int mShift2 = 0;
+        bool mIsPowerOfTwo = false;
+    };
+
+    /**
+     * 64-битный делитель для деления 128-битных чисел.
+     * Используется нормализованная обратная величина v = floor((2^128 - 1) / d) - 2^64,
+     * каждая 64-битная цифра частного находится двумя умножениями (Möller, Granlund, 2011).
+     * Семантика совпадает с оператором деления: частное округляется вниз, остаток неотрицателен.
+     */
+    template <>
+    class Divisor<ULOW>
+    {
+    public:
+        explicit Divisor(ULOW d)
+            : mDivisor{d}, mShift{std::countl_zero(d)}, mNormalized{d << mShift}
+        {
+            assert(d != 0);
+            ULOW r;
+            mReciprocal = U128::div128by64(~mNormalized, ~ULOW{0}, mNormalized, r);
+        }
+
+        /**
+         * @brief Делитель.
+         */
+        ULOW divisor() const
+        {
+            return mDivisor;
+        }
+
+        /**
+         * @brief Частное и остаток от деления.
+         */
+        std::pair<U128, U128> divmod(const U128 &x) const
+        {
+            if (x.is_singular())
+                return std::make_pair(x, U128{0});
+            const int s = mShift;
+            const ULOW u2 = s == 0 ? 0 : x.mHigh >> (64 - s);
+            const ULOW u1 = s == 0 ? x.mHigh : (x.mHigh << s) | (x.mLow >> (64 - s));
+            const ULOW u0 = x.mLow << s;
+            ULOW r;
+            const ULOW q_high = div_preinv(u2, u1, r);
+            const ULOW q_low = div_preinv(r, u0, r);
+            r >>= s;
+            U128 q{q_low, q_high, x.mSign};
+            if (x.mSign() && r != 0)
+            {
+                q.mLow++;
+                q.mHigh += q.mLow == 0;
+                r = mDivisor - r;
+            }
+            return std::make_pair(q, U128{r});
+        }
+
+        /**
+         * @brief Частное от деления.
+         */
+        U128 div(const U128 &x) const
+        {
+            return divmod(x).first;
+        }
+
+        /**
+         * @brief Остаток от деления.
+         */
+        U128 mod(const U128 &x) const
+        {
+            return divmod(x).second;
+        }
+
+        /**
+         * @brief Делится ли число на делитель без остатка.
+         */
+        bool divides(const U128 &x) const
+        {
+            if ((mDivisor & (mDivisor - 1)) == 0)
+                return (x.mLow & (mDivisor - 1)) == 0;
+            return mod(x).is_zero();
+        }
+
+    private:
+        /**
+         * Деление (u1, u0) на нормализованный делитель с предвычисленной обратной величиной.
+         * Требуется u1 < нормализованного делителя.
+         */
+        ULOW div_preinv(ULOW u1, ULOW u0, ULOW &remainder) const
+        {
+            const ULOW d = mNormalized;
+            U128 q = U128::mult64(mReciprocal, u1);
+            q.mSingular = Singular{};
+            q = U128::add_mod(q, U128{u0, u1});
+            ULOW q1 = q.mHigh + 1;
+            ULOW r = u0 - q1 * d;
+            if (r > q.mLow)
+            {
+                q1--;
+                r += d;
+            }
+            if (r >= d)
+            {
+                q1++;
+                r -= d;
+            }
+            remainder = r;
+            return q1;
+        }
+
+        ULOW mDivisor;
+        int mShift;
+        ULOW mNormalized;
+        ULOW mReciprocal = 0;
+    };
+}
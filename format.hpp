@@ -0,0 +1,101 @@
+#pragma once
+
+#include <ostream>     // std::ostream
+#include <string_view> // std::string_view
+
+#include "u128.hpp"
+#include "gnumber.hpp"
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+namespace u128
+{
+    /**
+     * @brief Вывод числа в поток без выделения памяти: запись в буфер на стеке через to_chars.
+     * @details Учитываются основание (std::dec, std::hex, std::oct) и ширина поля потока.
+     */
+    template <typename T>
+    std::ostream &write_to_stream(std::ostream &os, const T &x)
+    {
+        const auto basefield = os.flags() & std::ios_base::basefield;
+        const int base = basefield == std::ios_base::hex ? 16 : basefield == std::ios_base::oct ? 8 : 10;
+        char buffer[8 * sizeof(T) + 2]; // Не меньше, чем битов в числе: достаточно для любого основания.
+        const auto [end, _] = to_chars(buffer, buffer + sizeof(buffer), x, base);
+        return os << std::string_view(buffer, end - buffer);
+    }
+
+    inline std::ostream &operator<<(std::ostream &os, const U128 &x)
+    {
+        return write_to_stream(os, x);
+    }
+}
+
+template <typename ULOW, unsigned int mHalfWidth>
+std::ostream &operator<<(std::ostream &os, const GNumber<ULOW, mHalfWidth> &x)
+{
+    return u128::write_to_stream(os, x);
+}
+
+#if defined(__cpp_lib_format)
+namespace u128
+{
+    /**
+     * Форматирование для std::format: {}, {:d}, {:x}, {:o}, {:b}.
+     */
+    template <typename T>
+    struct NumberFormatter
+    {
+        int mBase = 10;
+
+        constexpr auto parse(std::format_parse_context &ctx)
+        {
+            auto it = ctx.begin();
+            if (it != ctx.end() && *it != '}')
+            {
+                switch (*it++)
+                {
+                case 'd':
+                    mBase = 10;
+                    break;
+                case 'x':
+                    mBase = 16;
+                    break;
+                case 'o':
+                    mBase = 8;
+                    break;
+                case 'b':
+                    mBase = 2;
+                    break;
+                default:
+                    throw std::format_error("Invalid format specifier");
+                }
+            }
+            if (it != ctx.end() && *it != '}')
+            {
+                throw std::format_error("Invalid format specifier");
+            }
+            return it;
+        }
+
+        template <typename FormatContext>
+        auto format(const T &x, FormatContext &ctx) const
+        {
+            char buffer[8 * sizeof(T) + 2];
+            const auto [end, _] = to_chars(buffer, buffer + sizeof(buffer), x, mBase);
+            return std::copy(buffer, end, ctx.out());
+        }
+    };
+}
+
+template <>
+struct std::formatter<u128::U128> : u128::NumberFormatter<u128::U128>
+{
+};
+
+template <typename ULOW, unsigned int mHalfWidth>
+struct std::formatter<GNumber<ULOW, mHalfWidth>> : u128::NumberFormatter<GNumber<ULOW, mHalfWidth>>
+{
+};
+#endif
@@ -17,6 +17,8 @@ template <typename ULOW, unsigned int mHalfWidth>
 struct GNumber
 {
     static constexpr ULOW mMaxULOW = ULOW::get_max_value();
+    // Количество 64-битных слов в числе.
+    static constexpr int mLimbs = 2 * ULOW::mLimbs;
     ULOW mLow{0};
     ULOW mHigh{0};
     Sign mSign{};
@@ -36,13 +38,13 @@ struct GNumber
 
     constexpr GNumber &operator=(const GNumber &other) = default;
 
-    bool operator==(const GNumber &other) const
+    constexpr bool operator==(const GNumber &other) const
     {
         const auto has_singular = mSingular != other.mSingular;
         return has_singular ? false : *this <=> other == 0;
     }
 
-    std::partial_ordering operator<=>(const GNumber &other) const
+    constexpr std::partial_ordering operator<=>(const GNumber &other) const
     {
         const auto has_singular = mSingular != other.mSingular;
         if (has_singular)
@@ -98,53 +100,53 @@ struct GNumber
         }
     }
 
-    bool is_singular() const
+    constexpr bool is_singular() const
     {
         return mSingular();
     }
 
-    bool is_overflow() const
+    constexpr bool is_overflow() const
     {
         return mSingular.IsOverflow() && !mSingular.IsNaN();
     }
 
-    bool is_nan() const
+    constexpr bool is_nan() const
     {
         return mSingular.IsNaN() && !mSingular.IsOverflow();
     }
 
-    bool is_zero() const
+    constexpr bool is_zero() const
     {
         return mLow.is_zero() && mHigh.is_zero() && !is_singular();
     }
 
-    bool is_unit() const
+    constexpr bool is_unit() const
     {
         return mLow.is_unit() && mHigh.is_zero() && !mSign() && !is_singular();
     }
 
-    bool is_negative() const
+    constexpr bool is_negative() const
     {
         return !is_zero() && mSign() && !is_singular();
     }
 
-    bool is_positive() const
+    constexpr bool is_positive() const
     {
         return !is_zero() && !mSign() && !is_singular();
     }
 
-    bool is_nonegative() const
+    constexpr bool is_nonegative() const
     {
         return is_positive() || is_zero();
     }
 
-    void set_overflow()
+    constexpr void set_overflow()
     {
         mSingular.mOverflow = 1;
         mSingular.mNaN = 0;
     }
 
-    void set_nan()
+    constexpr void set_nan()
     {
         mSingular.mOverflow = 0;
         mSingular.mNaN = 1;
@@ -155,7 +157,7 @@ struct GNumber
      * @details Сохраняет знак. Поведение аналогично поведению
      * такого же оператора для встроенных в язык С++ беззнаковых чисел. Для заведомо больших сдвигов дает переполнение.
      */
-    GNumber operator<<(uint32_t shift) const
+    constexpr GNumber operator<<(uint32_t shift) const
     {
         GNumber result = *this;
         if (shift >= (mHalfWidth*4u)) {
@@ -183,7 +185,7 @@ struct GNumber
         return result;
     }
 
-    GNumber &operator<<=(const uint32_t shift)
+    constexpr GNumber &operator<<=(const uint32_t shift)
     {
         *this = *this << shift;
         return *this;
@@ -194,7 +196,7 @@ struct GNumber
      * @details Сохраняет знак. Поведение аналогично поведению
      * такого же оператора для встроенных в язык С++ беззнаковых чисел. Для заведомо больших сдвигов дает ноль.
      */
-    GNumber operator>>(uint32_t shift) const
+    constexpr GNumber operator>>(uint32_t shift) const
     {
         if (shift >= (mHalfWidth * 4u)) {
             return GNumber{0};
@@ -221,13 +223,13 @@ struct GNumber
         return result;
     }
 
-    GNumber &operator>>=(const uint32_t shift)
+    constexpr GNumber &operator>>=(const uint32_t shift)
     {
         *this = *this >> shift;
         return *this;
     }
 
-    GNumber operator&(const GNumber &mask) const
+    constexpr GNumber operator&(const GNumber &mask) const
     {
         GNumber result = *this;
         result.mLow &= mask.mLow;
@@ -235,13 +237,13 @@ struct GNumber
         return result;
     }
 
-    GNumber &operator&=(const GNumber &mask)
+    constexpr GNumber &operator&=(const GNumber &mask)
     {
         *this = *this & mask;
         return *this;
     }
 
-    GNumber operator|(const GNumber &mask) const
+    constexpr GNumber operator|(const GNumber &mask) const
     {
         GNumber result = *this;
         result.mLow |= mask.mLow;
@@ -249,7 +251,7 @@ struct GNumber
         return result;
     }
 
-    GNumber &operator|=(const GNumber &mask)
+    constexpr GNumber &operator|=(const GNumber &mask)
     {
         *this = *this | mask;
         return *this;
@@ -258,7 +260,7 @@ struct GNumber
     /**
      * Оператор смены знака числа.
      */
-    GNumber operator-() const
+    constexpr GNumber operator-() const
     {
         GNumber result = *this;
         -result.mSign;
@@ -276,14 +278,14 @@ struct GNumber
         return result;
     }
 
-    GNumber abs() const
+    constexpr GNumber abs() const
     {
         GNumber result = *this;
         result.mSign = false;
         return result;
     }
 
-    GNumber operator+(GNumber rhs) const
+    constexpr GNumber operator+(GNumber rhs) const
     {
         GNumber result;
         GNumber X = *this;
@@ -305,26 +307,19 @@ struct GNumber
             result = X - rhs;
             return result;
         }
-        result.mLow = ULOW::add_mod(X.mLow, rhs.mLow);
-        const ULOW c1 = result.mLow < gutils::min(X.mLow, rhs.mLow) ? ULOW{1} : ULOW{0};
-        result.mHigh = ULOW::add_mod(X.mHigh, rhs.mHigh);
-        const int c2 = result.mHigh < gutils::min(X.mHigh, rhs.mHigh);
-        const ULOW tmp = result.mHigh;
-        result.mHigh = ULOW::add_mod(tmp, c1);
-        const int c3 = result.mHigh < gutils::min(tmp, c1);
-        result.mSingular.mOverflow = c2 || c3;
-        if (X.mSign() && rhs.mSign())
-            result.mSign = true;
+        result = X;
+        result.mSign = X.mSign() && rhs.mSign(); // Ноль со знаком "минус" не переносит знак на сумму.
+        result.mSingular.mOverflow = add_carry(result, rhs) != 0;
         return result;
     }
 
-    GNumber &operator+=(const GNumber &other)
+    constexpr GNumber &operator+=(const GNumber &other)
     {
         *this = *this + other;
         return *this;
     }
 
-    GNumber operator-(GNumber rhs) const
+    constexpr GNumber operator-(GNumber rhs) const
     {
         GNumber result;
         GNumber X = *this;
@@ -353,88 +348,137 @@ struct GNumber
         }
         if (X.is_zero())
             return -rhs;
-        result.mLow = ULOW::sub_mod(X.mLow, rhs.mLow);
-        result.mHigh = ULOW::sub_mod(X.mHigh, rhs.mHigh);
-        const bool borrow = X.mLow < rhs.mLow;
-        const bool hasUnit = X.mHigh > rhs.mHigh;
-        if (borrow && hasUnit)
-            result.mHigh = ULOW::sub_mod(result.mHigh, ULOW{1});
-        if (borrow && !hasUnit)
-        {
-            result = rhs - X;
-            return -result;
-        }
-        if (!borrow && X.mHigh < rhs.mHigh)
-        {
-            result.mHigh = ULOW::sub_mod(ULOW::neg_mod(result.mHigh), ULOW{result.mLow.is_zero() ? 0ull : 1ull});
-            result.mLow = ULOW::neg_mod(result.mLow);
+        result = X;
+        if (sub_borrow(result, rhs) != 0)
+        { // |X| < |rhs|: модуль разности - дополнение до 2^W.
+            const GNumber difference = result;
+            result = GNumber{0};
+            sub_borrow(result, difference);
             result.mSign = true;
         }
         return result;
     }
 
-    GNumber &operator-=(const GNumber &other)
+    constexpr GNumber &operator-=(const GNumber &other)
     {
         *this = *this - other;
         return *this;
     }
 
     /**
-     * @brief Инкремент числа.
+     * @brief Инкремент числа: одно сложение с переносом, без разбора знаков операндов.
      * @return Число + 1.
      */
-    GNumber &inc()
+    constexpr GNumber &inc()
     {
-        *this = *this + GNumber{1};
+        if (is_singular())
+        {
+            return *this;
+        }
+        if (is_negative())
+        { // Модуль не меньше единицы: заема из старшего разряда нет.
+            sub_borrow(*this, GNumber{1});
+            mSign = !is_zero();
+            return *this;
+        }
+        mSign = false;
+        mSingular.mOverflow = add_carry(*this, GNumber{1}) != 0;
         return *this;
     }
 
     /**
-     * @brief Декремент числа.
+     * @brief Декремент числа: одно вычитание с заемом, без разбора знаков операндов.
      * @return Число - 1.
      */
-    GNumber &dec()
+    constexpr GNumber &dec()
     {
-        *this = *this - GNumber{1};
+        if (is_singular())
+        {
+            return *this;
+        }
+        if (is_zero())
+        {
+            *this = GNumber{1};
+            mSign = true;
+            return *this;
+        }
+        if (mSign())
+        {
+            mSingular.mOverflow = add_carry(*this, GNumber{1}) != 0;
+            return *this;
+        }
+        sub_borrow(*this, GNumber{1});
         return *this;
     }
 
     /**
      * Беззнаковое умножение двух "половинок" с расширением до полного числа.
      */
-    static GNumber mult_ext(const ULOW &x, const ULOW &y)
-    {
-        const ULOW MASK = (ULOW{1} << mHalfWidth) - ULOW{1};
-        const ULOW x_low = x & MASK;
-        const ULOW y_low = y & MASK;
-        const ULOW x_high = x >> mHalfWidth;
-        const ULOW y_high = y >> mHalfWidth;
-        const ULOW t1 = ULOW::mult_mod(x_low, y_low);
-        const ULOW t = t1 >> mHalfWidth;
-        const ULOW t21 = ULOW::mult_mod(x_low, y_high);
-        const ULOW q = t21 >> mHalfWidth;
-        const ULOW p = t21 & MASK;
-        const ULOW t22 = ULOW::mult_mod(x_high, y_low);
-        const ULOW s = t22 >> mHalfWidth;
-        const ULOW r = t22 & MASK;
-        const ULOW t3 = ULOW::mult_mod(x_high, y_high);
-        GNumber result{t1, ULOW{0}};
-        const ULOW div = ULOW::add_mod(ULOW::add_mod(q, s), (ULOW::add_mod(ULOW::add_mod(p, r), t) >> mHalfWidth));
-        const auto p1 = t21 << mHalfWidth;
-        const auto p2 = t22 << mHalfWidth;
-        const ULOW mod = ULOW::add_mod(p1, p2);
-        result.mLow = ULOW::add_mod(result.mLow, mod);
-        result.mHigh = ULOW::add_mod(result.mHigh, div);
-        result.mHigh = ULOW::add_mod(result.mHigh, t3);
-        result.mSingular.mOverflow = result.mHigh < t3;
-        return result;
+    static constexpr GNumber mult_ext(const ULOW &x, const ULOW &y)
+    {
+        const auto &[low, high] = ULOW::mul_wide(x, y);
+        return GNumber{low, high};
+    }
+
+    /**
+     * Беззнаковый квадрат "половинки" с расширением до полного числа.
+     */
+    static constexpr GNumber sqr_ext(const ULOW &x)
+    {
+        const auto &[low, high] = ULOW::sqr_wide(x);
+        return GNumber{low, high};
+    }
+
+    /**
+     * @brief Полное произведение беззнаковых частей двух чисел.
+     * @details Четыре произведения половин (mult_ext) и сложение средних слагаемых с переносами.
+     * @return Пара {младшая половина, старшая половина} произведения удвоенной разрядности.
+     */
+    static constexpr std::pair<GNumber, GNumber> mul_wide(const GNumber &x, const GNumber &y)
+    {
+        const GNumber &ll = mult_ext(x.mLow, y.mLow);
+        const GNumber &hl = mult_ext(x.mHigh, y.mLow);
+        GNumber middle = mult_ext(x.mLow, y.mHigh);
+        GNumber low = ll;
+        GNumber high = mult_ext(x.mHigh, y.mHigh);
+        const uint64_t middle_carry = add_carry(middle, hl);
+        const uint64_t low_carry = ULOW::add_carry(low.mHigh, middle.mLow);
+        add_carry(high, GNumber{middle.mHigh, ULOW{0}}, low_carry);
+        ULOW::add_carry(high.mHigh, ULOW{middle_carry});
+        return std::make_pair(low, high);
+    }
+
+    /**
+     * @brief Старшая половина полного произведения беззнаковых частей двух чисел.
+     */
+    static constexpr GNumber mulhi(const GNumber &x, const GNumber &y)
+    {
+        return mul_wide(x, y).second;
+    }
+
+    /**
+     * @brief Полный квадрат беззнаковой части числа.
+     * @details Три произведения половин вместо четырех: среднее слагаемое вычисляется один раз и удваивается.
+     * @return Пара {младшая половина, старшая половина} квадрата удвоенной разрядности.
+     */
+    static constexpr std::pair<GNumber, GNumber> sqr_wide(const GNumber &x)
+    {
+        const GNumber &lh = mult_ext(x.mLow, x.mHigh);
+        GNumber middle = lh;
+        GNumber low = sqr_ext(x.mLow);
+        GNumber high = sqr_ext(x.mHigh);
+        const uint64_t middle_carry = add_carry(middle, lh);
+        const uint64_t low_carry = ULOW::add_carry(low.mHigh, middle.mLow);
+        add_carry(high, GNumber{middle.mHigh, ULOW{0}}, low_carry);
+        ULOW::add_carry(high.mHigh, ULOW{middle_carry});
+        return std::make_pair(low, high);
     }
 
     /**
      * @brief Складывает два числа как беззнаковые по базовому модулю.
      * @details Поведение аналогично сложению встроенных в язык С++ беззнаковых чисел.
      */
-    static GNumber add_mod(const GNumber &x, const GNumber &y)
+    static constexpr GNumber add_mod(const GNumber &x, const GNumber &y)
     {
         if (x.is_overflow() || y.is_overflow())
         {
@@ -448,10 +492,8 @@ struct GNumber
             result.set_nan();
             return result;
         }
-        const ULOW &ac = ULOW::add_mod(x.mLow, y.mLow);
-        ULOW bd = ULOW::add_mod(x.mHigh, y.mHigh);
-        bd = ac < std::min(x.mLow, y.mLow) ? ULOW::add_mod(bd, ULOW{1u}) : bd;
-        GNumber result{ac, bd};
+        GNumber result{x.mLow, x.mHigh};
+        add_carry(result, y);
         return result;
     }
 
@@ -459,7 +501,7 @@ struct GNumber
      * @brief Вычитает два числа как беззнаковые по базовому модулю.
      * @details Поведение аналогично вычитанию встроенных в язык С++ беззнаковых чисел.
      */
-    static GNumber sub_mod(const GNumber &x, const GNumber &y)
+    static constexpr GNumber sub_mod(const GNumber &x, const GNumber &y)
     {
         if (x.is_overflow() || y.is_overflow())
         {
@@ -473,26 +515,16 @@ struct GNumber
             result.set_nan();
             return result;
         }
-        if (x >= y)
-        {
-            const ULOW &ac = ULOW::sub_mod(x.mLow, y.mLow);
-            ULOW bd = ULOW::sub_mod(x.mHigh, y.mHigh);
-            bd = x.mLow < y.mLow ? ULOW::sub_mod(bd, ULOW{1u}) : bd;
-            GNumber result{ac, bd};
-            return result;
-        }
-        else
-        {
-            const GNumber &tmp = get_max_value() - y;
-            return add_mod(x, add_mod(tmp, GNumber{1}));
-        }
+        GNumber result{x.mLow, x.mHigh};
+        sub_borrow(result, y);
+        return result;
     }
 
     /**
      * @brief Смена знака, приводится по базовому модулю.
      * @details y = (-x) mod 2^W.
      */
-    static GNumber neg_mod(const GNumber &x)
+    static constexpr GNumber neg_mod(const GNumber &x)
     {
         return sub_mod(GNumber{0}, x);
     }
@@ -501,7 +533,7 @@ struct GNumber
      * @brief Вычисляет произведение двух W-битных чисел как беззнаковых по модулю 2^W.
      * @details Поведение аналогично умножению встроенных в язык С++ беззнаковых чисел.
      */
-    static GNumber mult_mod(const GNumber &x, const GNumber &y)
+    static constexpr GNumber mult_mod(const GNumber &x, const GNumber &y)
     {
         // x*y = (a + w*b)(c + w*d) = ac + w*(ad + bc) + w*w*bd = (ac + w*(ad + bc)) mod 2^128;
         if (x.is_overflow() || y.is_overflow())
@@ -516,16 +548,10 @@ struct GNumber
             result.set_nan();
             return result;
         }
-        const GNumber &ac = mult_ext(x.mLow, y.mLow);
-        const GNumber &ad = mult_ext(x.mLow, y.mHigh);
-        const GNumber &bc = mult_ext(x.mHigh, y.mLow);
-        GNumber result = add_mod(ad, bc);
-        result = shl_half_width_mod(result);
-        result = add_mod(result, ac);
-        return result;
+        return mul_low(x, y);
     }
 
-    GNumber operator*(const ULOW &rhs) const
+    constexpr GNumber operator*(const ULOW &rhs) const
     {
         if (this->is_singular())
             return *this;
@@ -546,7 +572,7 @@ struct GNumber
         return result;
     }
 
-    GNumber operator*(const GNumber &rhs) const
+    constexpr GNumber operator*(const GNumber &rhs) const
     {
         const GNumber X = *this;
         if (X.is_overflow() || rhs.is_overflow())
@@ -561,6 +587,8 @@ struct GNumber
             result.set_nan();
             return result;
         }
+        if (this == &rhs)
+            return sqr();
         if (X.is_zero())
             return GNumber{0};
         if (rhs.is_zero())
@@ -568,16 +596,37 @@ struct GNumber
         GNumber result = X * rhs.mLow;
         if (result.is_singular())
             return result;
+        result = result + shl_half_width(X * rhs.mHigh); // Оба слагаемых со знаком X.
         result.mSign = this->mSign() ^ rhs.mSign();
-        result = result + shl_half_width(X * rhs.mHigh);
         return result;
     }
 
+    /**
+     * @brief Квадрат числа. Результат неотрицателен.
+     * @details Ненулевая старшая половина дает переполнение, иначе - квадрат младшей половины с расширением.
+     */
+    constexpr GNumber sqr() const
+    {
+        if (is_singular())
+        {
+            GNumber result;
+            result.mSingular = mSingular;
+            return result;
+        }
+        if (!mHigh.is_zero())
+        {
+            GNumber result;
+            result.set_overflow();
+            return result;
+        }
+        return sqr_ext(mLow);
+    }
+
     /**
      * Вспомогательный метод деления на 10 для формирования
      * строкового представления числа.
      */
-    GNumber div10() const
+    constexpr GNumber div10() const
     {
         GNumber X = *this;
         if (X.is_singular())
@@ -594,7 +643,7 @@ struct GNumber
             big_division = mMaxULOW.div10();
         }
         ULOW N { R.is_zero() ? X.mLow.div10() : R * big_division + X.mLow.div10() };
-        static constexpr ULOW TEN = ULOW{10};
+        const ULOW TEN = ULOW{10};
         GNumber result{N, Q};
         GNumber E { X - (result * TEN) };
         while (!E.mHigh.is_zero() || E.mLow >= TEN)
@@ -614,7 +663,7 @@ struct GNumber
      * Вспомогательный метод нахождения остатка от деления на 10 для формирования
      * строкового представления числа.
      */
-    int mod10() const
+    constexpr int mod10() const
     {
         if (this->is_singular())
             return -1;
@@ -624,11 +673,192 @@ struct GNumber
         return (mLow.mod10() + multiplier_mod10 * mHigh.mod10()) % 10;
     }
 
+    /**
+     * @brief Деление беззнаковой части "в столбик" 64-битными цифрами на 64-битное число.
+     * @details Делится число remainder * 2^W + |x|, требуется remainder < y.
+     * Частное записывается в x, знак и флаги не меняются.
+     * @return Остаток от деления.
+     */
+    static constexpr uint64_t short_divmod(GNumber &x, uint64_t y, uint64_t remainder = 0)
+    {
+        remainder = ULOW::short_divmod(x.mHigh, y, remainder);
+        return ULOW::short_divmod(x.mLow, y, remainder);
+    }
+
+    /**
+     * @brief Умножение беззнаковой части на 64-битное число со сложением: |x| = |x| * y + addend.
+     * @details Знак и флаги не меняются.
+     * @return Перенос: старшие 64 бита результата, не уместившиеся в разрядность числа.
+     */
+    static constexpr uint64_t mul_add_short(GNumber &x, uint64_t y, uint64_t addend)
+    {
+        const uint64_t carry = ULOW::mul_add_short(x.mLow, y, addend);
+        return ULOW::mul_add_short(x.mHigh, y, carry);
+    }
+
+    /**
+     * @brief Сложение беззнаковых частей с переносом: |x| = (|x| + |y| + carry) mod 2^W.
+     * @details Без проверок знаков и флагов на каждом уровне рекурсии; знак и флаги x не меняются.
+     * @return Перенос из старшего разряда: 0 или 1.
+     */
+    static constexpr uint64_t add_carry(GNumber &x, const GNumber &y, uint64_t carry = 0)
+    {
+        carry = ULOW::add_carry(x.mLow, y.mLow, carry);
+        return ULOW::add_carry(x.mHigh, y.mHigh, carry);
+    }
+
+    /**
+     * @brief Вычитание беззнаковых частей с заемом: |x| = (|x| - |y| - borrow) mod 2^W.
+     * @details Без проверок знаков и флагов на каждом уровне рекурсии; знак и флаги x не меняются.
+     * @return Заем из старшего разряда: 0 или 1.
+     */
+    static constexpr uint64_t sub_borrow(GNumber &x, const GNumber &y, uint64_t borrow = 0)
+    {
+        borrow = ULOW::sub_borrow(x.mLow, y.mLow, borrow);
+        return ULOW::sub_borrow(x.mHigh, y.mHigh, borrow);
+    }
+
+    /**
+     * @brief Младшая половина произведения беззнаковых частей (по модулю 2^W), без проверок знаков и флагов.
+     */
+    static constexpr GNumber mul_low(const GNumber &x, const GNumber &y)
+    {
+        GNumber result = mult_ext(x.mLow, y.mLow);
+        ULOW cross = ULOW::mul_low(x.mLow, y.mHigh);
+        ULOW::add_carry(cross, ULOW::mul_low(x.mHigh, y.mLow));
+        ULOW::add_carry(result.mHigh, cross);
+        return result;
+    }
+
+    /**
+     * @brief Записывает беззнаковую часть в массив из mLimbs 64-битных слов, младшие слова - первыми.
+     */
+    static constexpr void store_limbs(const GNumber &x, uint64_t *limbs)
+    {
+        ULOW::store_limbs(x.mLow, limbs);
+        ULOW::store_limbs(x.mHigh, limbs + ULOW::mLimbs);
+    }
+
+    /**
+     * @brief Читает беззнаковую часть из массива mLimbs 64-битных слов, младшие слова - первыми.
+     * @details Знак и флаги не меняются.
+     */
+    static constexpr void load_limbs(GNumber &x, const uint64_t *limbs)
+    {
+        ULOW::load_limbs(x.mLow, limbs);
+        ULOW::load_limbs(x.mHigh, limbs + ULOW::mLimbs);
+    }
+
+    /**
+     * @brief Остаток от деления числа двойной ширины high * 2^W + low на m: беззнаковые части, без флагов.
+     * @details Алгоритм D Кнута по 64-битным цифрам: цифра частного оценивается делением 128/64 и уточняется
+     * по второй цифре делителя, после умножения с вычитанием - не более двух обратных сложений.
+     * Полное частное не формируется.
+     */
+    static constexpr GNumber mod_wide(const GNumber &low, const GNumber &high, const GNumber &m)
+    {
+        using u128::U128;
+        constexpr int n = mLimbs;
+        uint64_t v[n]{};
+        store_limbs(m, v);
+        int nv = n;
+        while (nv > 0 && v[nv - 1] == 0)
+        {
+            --nv;
+        }
+        assert(nv > 0);
+        uint64_t u[2 * n + 1]{};
+        store_limbs(low, u);
+        store_limbs(high, u + n);
+        GNumber result;
+        if (nv == 1)
+        {
+            uint64_t r = 0;
+            for (int i = 2 * n - 1; i >= 0; --i)
+            {
+                U128::div128by64(r, u[i], v[0], r);
+            }
+            return GNumber{r};
+        }
+        // Нормализация: старший бит делителя равен единице.
+        const int s = std::countl_zero(v[nv - 1]);
+        if (s != 0)
+        {
+            for (int i = nv - 1; i > 0; --i)
+            {
+                v[i] = (v[i] << s) | (v[i - 1] >> (64 - s));
+            }
+            v[0] <<= s;
+            for (int i = 2 * n; i > 0; --i)
+            {
+                u[i] = (u[i] << s) | (u[i - 1] >> (64 - s));
+            }
+            u[0] <<= s;
+        }
+        const uint64_t v1 = v[nv - 1];
+        const uint64_t v0 = v[nv - 2];
+        for (int j = 2 * n - nv; j >= 0; --j)
+        {
+            uint64_t qhat = ~uint64_t{0};
+            if (u[j + nv] < v1)
+            {
+                uint64_t rhat;
+                qhat = U128::div128by64(u[j + nv], u[j + nv - 1], v1, rhat);
+                for (U128 p = U128::mult64(qhat, v0); p.mHigh > rhat || (p.mHigh == rhat && p.mLow > u[j + nv - 2]);)
+                {
+                    qhat--;
+                    const uint64_t previous = rhat;
+                    rhat += v1;
+                    if (rhat < previous)
+                    {
+                        break;
+                    }
+                    p = U128::mult64(qhat, v0);
+                }
+            }
+            // u[j..j+nv] -= qhat * v.
+            uint64_t carry = 0;
+            uint64_t borrow = 0;
+            for (int i = 0; i < nv; ++i)
+            {
+                const U128 p = U128::mult64(qhat, v[i]);
+                const uint64_t product = p.mLow + carry;
+                carry = p.mHigh + (product < carry);
+                const uint64_t t = u[i + j];
+                u[i + j] = t - product - borrow;
+                borrow = (t < product) | (t - product < borrow);
+            }
+            const uint64_t t = u[j + nv];
+            u[j + nv] = t - carry - borrow;
+            bool negative = (t < carry) | (t - carry < borrow);
+            while (negative) // Обратное сложение, пока не будет переноса из старшей цифры.
+            {
+                uint64_t c = 0;
+                for (int i = 0; i < nv; ++i)
+                {
+                    const uint64_t sum = u[i + j] + v[i];
+                    const uint64_t total = sum + c;
+                    c = (sum < v[i]) | (total < c);
+                    u[i + j] = total;
+                }
+                u[j + nv] += c;
+                negative = !(c != 0 && u[j + nv] == 0);
+            }
+        }
+        uint64_t r[n]{};
+        for (int i = 0; i < nv; ++i)
+        {
+            r[i] = s == 0 ? u[i] : (u[i] >> s) | (u[i + 1] << (64 - s));
+        }
+        load_limbs(result, r);
+        return result;
+    }
+
     // Метод итеративного деления широкого числа на узкое.
     // Наиболее вероятное количество итераций: ~N/4, где N - количество битов узкого числа.
     // В данном случае имеем ~64/4 = 16 итераций.
     // Максимум до ~(N+1) итерации.
-    std::pair<GNumber, GNumber> operator/(const ULOW &y) const
+    constexpr std::pair<GNumber, GNumber> operator/(const ULOW &y) const
     {
         assert(!y.is_zero());
         const GNumber X = *this;
@@ -672,7 +902,7 @@ struct GNumber
         return std::make_pair(result, E);
     }
 
-    std::pair<GNumber, GNumber> operator/=(const ULOW &y)
+    constexpr std::pair<GNumber, GNumber> operator/=(const ULOW &y)
     {
         GNumber remainder;
         std::tie(*this, remainder) = *this / y;
@@ -682,7 +912,7 @@ struct GNumber
     // Метод деления двух широких чисел.
     // Отсутствует "раскачка" алгоритма для "плохих" случаев деления: (A*M + B)/(1*M + D).
     // Наиболее вероятное общее количество итераций: 4...6.
-    std::pair<GNumber, GNumber> operator/(const GNumber &other) const
+    constexpr std::pair<GNumber, GNumber> operator/(const GNumber &other) const
     {
         assert(!other.is_zero());
         GNumber X = *this;
@@ -761,34 +991,104 @@ struct GNumber
     }
 
     /**
-     * Возвращает строковое представление числа.
+     * @brief Частное от деления, округленное вниз: то же, что (x / d).first.
+     * @details Если оба операнда умещаются в младшую половину, деление выполняется на половинной
+     * разрядности, вплоть до 64-битного деления.
      */
-    std::string value() const
+    static constexpr GNumber div(const GNumber &x, const GNumber &d)
     {
-        std::string result;
-        if (this->is_overflow())
+        assert(!d.is_zero());
+        if (!x.is_singular() && !d.is_singular() && x.mHigh.is_zero() && d.mHigh.is_zero())
         {
-            result = u128::INF;
-            return result;
+            const ULOW &q = ULOW::div(low_half(x), low_half(d));
+            return GNumber{q.abs(), ULOW{0}, q.mSign};
         }
-        if (this->is_nan())
+        return (x / d).first;
+    }
+
+    /**
+     * @brief Остаток от деления, неотрицательный: то же, что (x / d).second.
+     * @details Если оба операнда умещаются в младшую половину, деление выполняется на половинной разрядности.
+     */
+    static constexpr GNumber mod(const GNumber &x, const GNumber &d)
+    {
+        assert(!d.is_zero());
+        if (!x.is_singular() && !d.is_singular() && x.mHigh.is_zero() && d.mHigh.is_zero())
         {
-            result = "";
-            return result;
+            return GNumber{ULOW::mod(low_half(x), low_half(d)), ULOW{0}};
         }
-        GNumber X = *this;
-        while (!X.is_zero())
+        return (x / d).second;
+    }
+
+    /**
+     * @brief Делится ли x на d без остатка.
+     * @details Ранний выход без деления: у x меньше младших нулевых битов, чем у d,
+     * или |x| < |d|. Знаки операндов не влияют на результат.
+     */
+    static constexpr bool divides(const GNumber &x, const GNumber &d)
+    {
+        assert(!d.is_zero());
+        if (x.is_singular() || d.is_singular())
+            return false;
+        if (countr_zero(x) < countr_zero(d))
+            return false;
+        if (x.mHigh.is_zero() && d.mHigh.is_zero())
+            return ULOW::divides(x.mLow, d.mLow);
+        const auto high_cmp = x.mHigh <=> d.mHigh;
+        if (high_cmp < 0 || (high_cmp == 0 && x.mLow < d.mLow))
+            return x.is_zero();
+        return (x / d).second.is_zero();
+    }
+
+    /**
+     * @brief Обратный элемент нечетного числа по модулю 2^W, W - разрядность числа.
+     * @details Обратный элемент младшей половины верен по модулю 2^(W/2): одна итерация Ньютона
+     * inv = inv * (2 - d * inv) удваивает количество верных битов.
+     */
+    static constexpr GNumber inverse_mod_pow2(const GNumber &d)
+    {
+        assert(countr_zero(d) == 0);
+        const GNumber x{ULOW::inverse_mod_pow2(d.mLow), ULOW{0}};
+        return mult_mod(x, sub_mod(GNumber{2}, mult_mod(GNumber{d.mLow, d.mHigh}, x)));
+    }
+
+    /**
+     * @brief Точное деление: x обязано делиться на d без остатка, иначе результат не определен.
+     * @details Деление заменяется умножением на обратный элемент нечетной части делителя по модулю 2^W
+     * (Jebelean). Если оба операнда умещаются в младшую половину, выполняется на половинной разрядности.
+     * С U128_DEBUG_DIVEXACT делимость проверяется обратным умножением.
+     */
+    static constexpr GNumber divexact(const GNumber &x, const GNumber &d)
+    {
+        assert(!d.is_zero());
+        if (x.is_singular() || d.is_singular())
+            return (x / d).first;
+        if (x.mHigh.is_zero() && d.mHigh.is_zero())
         {
-            const int d = X.mod10();
-            if (d < 0)
-                return result;
-            result.push_back(u128::DIGITS[d]);
-            X = X.div10();
+            const ULOW &q = ULOW::divexact(low_half(x), low_half(d));
+            return GNumber{q.abs(), ULOW{0}, q.mSign};
         }
-        if (this->is_negative() && !this->is_zero())
-            result.push_back('-');
-        std::reverse(result.begin(), result.end());
-        return result.length() != 0 ? result : "0";
+        const int s = countr_zero(d);
+        const GNumber &n = GNumber{x.mLow, x.mHigh} >> s;
+        const GNumber &odd = GNumber{d.mLow, d.mHigh} >> s;
+        GNumber result = odd.is_unit() ? n : mult_mod(n, inverse_mod_pow2(odd));
+#ifdef U128_DEBUG_DIVEXACT
+        // Частное неделящегося x велико: произведение на d переполняется или не равно x.
+        assert((result * GNumber{d.mLow, d.mHigh} == GNumber{x.mLow, x.mHigh}));
+#endif
+        result.mSign = x.mSign != d.mSign;
+        return result;
+    }
+
+    /**
+     * Возвращает строковое представление числа.
+     * Цифры формируются порциями по 19 - делением на 10^19 - и записываются парами, см. u128::to_chars.
+     */
+    constexpr std::string value() const
+    {
+        char buffer[4 * mHalfWidth / 3 + 2]; // log10(2) < 1/3: с запасом для цифр и знака.
+        const auto [end, _] = u128::to_chars(buffer, buffer + sizeof(buffer), *this);
+        return std::string(buffer, end);
     }
 
     static constexpr GNumber get_max_value()
@@ -797,13 +1097,23 @@ struct GNumber
         return ~result;
     }
 
+    /**
+     * Младшая половина числа со знаком числа.
+     */
+    static constexpr ULOW low_half(const GNumber &x)
+    {
+        ULOW result = x.mLow;
+        result.mSign = x.mSign;
+        return result;
+    }
+
     /**
      * Сдвиг влево на полширины беззнаковой части по базовому модулю.
      * Сохраняет знак.
      */
-    static GNumber shl_half_width_mod(const GNumber &x)
+    static constexpr GNumber shl_half_width_mod(const GNumber &x)
     { // sgn(x) * ((|x| * 2^(W/2)) mod 2^W)
-        GNumber result{x.mHigh >> 1, x.mLow, x.mSign};
+        GNumber result{ULOW{0}, x.mLow, x.mSign};
         result.mSingular = x.mSingular;
         return result;
     }
@@ -812,7 +1122,7 @@ struct GNumber
      * Сдвиг влево на полширины беззнаковой части.
      * Сохраняет знак. С переполнением.
      */
-    static GNumber shl_half_width(const GNumber &x)
+    static constexpr GNumber shl_half_width(const GNumber &x)
     { // x * 2^(W/2)
         GNumber result{ULOW{0}, x.mLow, x.mSign};
         result.mSingular = x.mSingular;
@@ -820,4 +1130,64 @@ struct GNumber
             result.set_overflow();
         return result;
     }
-};
\ No newline at end of file
+};
+
+namespace u128
+{
+    /**
+     * @brief Количество старших нулевых битов беззнаковой части: разрядность числа для нуля.
+     */
+    template <typename ULOW, unsigned int mHalfWidth>
+    constexpr int countl_zero(const GNumber<ULOW, mHalfWidth> &x)
+    {
+        const int high = countl_zero(x.mHigh);
+        return high < static_cast<int>(2 * mHalfWidth) ? high : high + countl_zero(x.mLow);
+    }
+
+    /**
+     * @brief Количество младших нулевых битов беззнаковой части: разрядность числа для нуля.
+     */
+    template <typename ULOW, unsigned int mHalfWidth>
+    constexpr int countr_zero(const GNumber<ULOW, mHalfWidth> &x)
+    {
+        const int low = countr_zero(x.mLow);
+        return low < static_cast<int>(2 * mHalfWidth) ? low : low + countr_zero(x.mHigh);
+    }
+
+    /**
+     * @brief Количество единичных битов беззнаковой части.
+     */
+    template <typename ULOW, unsigned int mHalfWidth>
+    constexpr int popcount(const GNumber<ULOW, mHalfWidth> &x)
+    {
+        return popcount(x.mLow) + popcount(x.mHigh);
+    }
+
+    /**
+     * @brief Бит с номером i беззнаковой части числа, 0 <= i < 4 * mHalfWidth.
+     */
+    template <typename ULOW, unsigned int mHalfWidth>
+    constexpr bool test_bit(const GNumber<ULOW, mHalfWidth> &x, int i)
+    {
+        constexpr int half = 2 * mHalfWidth;
+        return i < half ? test_bit(x.mLow, i) : test_bit(x.mHigh, i - half);
+    }
+
+    /**
+     * @brief Количество значащих битов беззнаковой части: 0 для нуля.
+     */
+    template <typename ULOW, unsigned int mHalfWidth>
+    constexpr int bit_width(const GNumber<ULOW, mHalfWidth> &x)
+    {
+        return 4 * mHalfWidth - countl_zero(x);
+    }
+}
+
+namespace u128::literals
+{
+    template <char... Chars>
+    consteval GNumber<U128, 64> operator""_u256()
+    {
+        return parse_literal<GNumber<U128, 64>, Chars...>();
+    }
+}
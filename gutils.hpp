@@ -3,7 +3,7 @@
 namespace gutils {
 
 template <typename T>
-inline T min(T x, T y)
+constexpr T min(T x, T y)
 {
     if (x.is_singular()) return x;
     if (y.is_singular()) return y;
@@ -12,7 +12,7 @@ inline T min(T x, T y)
 }
 
 template <typename T>
-inline T max(T x, T y)
+constexpr T max(T x, T y)
 {
     if (x.is_singular()) return x;
     if (y.is_singular()) return y;
@@ -0,0 +1,406 @@
+#pragma once
+
+#include <compare> // std::partial_ordering
+#include <cstdint> // int64_t
+#include <string>  // std::string
+
+#include "u128.hpp"
+#include "gnumber.hpp"
+
+namespace u128
+{
+    namespace twos_detail
+    {
+        /**
+         * Флаги результата сложения или вычитания по флагам операндов и признаку переполнения операции.
+         * NaN поглощает переполнение, чтобы было установлено не более одного флага.
+         */
+        inline Singular propagate(const Singular &x, const Singular &y, ULOW overflow)
+        {
+            const bool nan = x.IsNaN() | y.IsNaN();
+            const bool any_overflow = x.IsOverflow() | y.IsOverflow() | (overflow != 0);
+            return Singular{any_overflow && !nan, nan};
+        }
+    }
+
+    /**
+     * Знаковое 128-битное число в дополнительном коде.
+     * Сложение и вычитание выполняются одной цепочкой переносов без ветвлений,
+     * переполнение детектируется по знаковым битам и запоминается (флаг "липкий").
+     * Диапазон: [-2^127, 2^127 - 1].
+     */
+    struct I128
+    {
+        ULOW mLow = 0;
+        ULOW mHigh = 0;
+        Singular mSingular{};
+
+        explicit constexpr I128() = default;
+
+        explicit constexpr I128(int64_t x)
+            : mLow{static_cast<ULOW>(x)}, mHigh{x < 0 ? mMaxULOW : ULOW{0}} {};
+
+        explicit constexpr I128(ULOW low, ULOW high)
+            : mLow{low}, mHigh{high} {};
+
+        /**
+         * @brief Преобразование из числа в прямом коде.
+         * @details Модуль, не умещающийся в диапазон I128, дает переполнение.
+         */
+        explicit I128(const U128 &x)
+            : mLow{x.mLow}, mHigh{x.mHigh}, mSingular{x.mSingular}
+        {
+            if (x.is_singular())
+            {
+                return;
+            }
+            const bool negative = x.is_negative();
+            const bool too_big = (mHigh > mSignBit) || (mHigh == mSignBit && (mLow != 0 || !negative));
+            if (too_big)
+            {
+                set_overflow();
+                return;
+            }
+            if (negative)
+            {
+                *this = negate(*this);
+            }
+        }
+
+        constexpr I128(const I128 &other) = default;
+
+        constexpr I128 &operator=(const I128 &other) = default;
+
+        /**
+         * @brief Преобразование в число в прямом коде. Всегда без потерь.
+         */
+        U128 to_u128() const
+        {
+            const bool negative = is_negative();
+            const I128 magnitude = negative ? negate(*this) : *this;
+            U128 result{magnitude.mLow, magnitude.mHigh, Sign{negative}};
+            result.mSingular = mSingular;
+            return result;
+        }
+
+        bool operator==(const I128 &other) const
+        {
+            const auto has_singular = mSingular != other.mSingular;
+            return has_singular ? false : (mLow == other.mLow && mHigh == other.mHigh);
+        }
+
+        std::partial_ordering operator<=>(const I128 &other) const
+        {
+            const auto has_singular = mSingular != other.mSingular;
+            if (has_singular)
+            {
+                return std::partial_ordering::unordered;
+            }
+            const auto high_cmp = static_cast<int64_t>(mHigh) <=> static_cast<int64_t>(other.mHigh);
+            if (high_cmp != 0)
+            {
+                return high_cmp;
+            }
+            return mLow <=> other.mLow;
+        }
+
+        bool is_singular() const
+        {
+            return mSingular();
+        }
+
+        bool is_overflow() const
+        {
+            return mSingular.IsOverflow() && !mSingular.IsNaN();
+        }
+
+        bool is_nan() const
+        {
+            return mSingular.IsNaN() && !mSingular.IsOverflow();
+        }
+
+        bool is_zero() const
+        {
+            return mLow == 0 && mHigh == 0 && !is_singular();
+        }
+
+        bool is_negative() const
+        {
+            return (mHigh & mSignBit) != 0 && !is_singular();
+        }
+
+        void set_overflow()
+        {
+            mSingular.mOverflow = 1;
+            mSingular.mNaN = 0;
+        }
+
+        void set_nan()
+        {
+            mSingular.mOverflow = 0;
+            mSingular.mNaN = 1;
+        }
+
+        /**
+         * @brief Сложение в дополнительном коде.
+         * @details Переполнение: знаки слагаемых совпадают, а знак суммы отличается.
+         */
+        I128 operator+(const I128 &rhs) const
+        {
+            I128 result;
+            result.mLow = mLow + rhs.mLow;
+            const ULOW carry = result.mLow < mLow;
+            result.mHigh = mHigh + rhs.mHigh + carry;
+            const ULOW overflow = ((mHigh ^ result.mHigh) & (rhs.mHigh ^ result.mHigh)) >> 63;
+            result.mSingular = twos_detail::propagate(mSingular, rhs.mSingular, overflow);
+            return result;
+        }
+
+        I128 &operator+=(const I128 &other)
+        {
+            *this = *this + other;
+            return *this;
+        }
+
+        /**
+         * @brief Вычитание в дополнительном коде.
+         * @details Переполнение: знаки операндов различны, а знак разности не совпадает со знаком уменьшаемого.
+         */
+        I128 operator-(const I128 &rhs) const
+        {
+            I128 result;
+            result.mLow = mLow - rhs.mLow;
+            const ULOW borrow = mLow < rhs.mLow;
+            result.mHigh = mHigh - rhs.mHigh - borrow;
+            const ULOW overflow = ((mHigh ^ rhs.mHigh) & (mHigh ^ result.mHigh)) >> 63;
+            result.mSingular = twos_detail::propagate(mSingular, rhs.mSingular, overflow);
+            return result;
+        }
+
+        I128 &operator-=(const I128 &other)
+        {
+            *this = *this - other;
+            return *this;
+        }
+
+        /**
+         * Оператор смены знака. Для -2^127 дает переполнение.
+         */
+        I128 operator-() const
+        {
+            return I128{} - *this;
+        }
+
+        /**
+         * Возвращает строковое представление числа.
+         */
+        std::string value() const
+        {
+            return to_u128().value();
+        }
+
+        static constexpr I128 get_max_value()
+        {
+            return I128{mMaxULOW, mSignBit - 1};
+        }
+
+        static constexpr I128 get_min_value()
+        {
+            return I128{0, mSignBit};
+        }
+
+    private:
+        static constexpr ULOW mMaxULOW = ULOW{-1ull};
+        static constexpr ULOW mSignBit = ULOW{1} << 63;
+
+        /**
+         * Смена знака по модулю 2^128, без флагов.
+         */
+        static I128 negate(const I128 &x)
+        {
+            I128 result{~x.mLow + 1, ~x.mHigh + (x.mLow == 0)};
+            return result;
+        }
+    }; // struct I128
+
+    /**
+     * Знаковое число в дополнительном коде на базе беззнакового представления T (U128, GNumber).
+     * Биты числа хранятся в T с неотрицательным знаком; флаг переполнения T используется как "липкий".
+     * Сложение и вычитание - одна цепочка переносов T::add_carry/T::sub_borrow без проверок флагов;
+     * знак читается из старшего бита старшей 64-битной цифры.
+     */
+    template <typename T>
+    struct TwosComplement
+    {
+        T mBits{0};
+
+        explicit constexpr TwosComplement() = default;
+
+        explicit TwosComplement(int64_t x)
+            : mBits{x < 0 ? T::neg_mod(T{static_cast<uint64_t>(-(x + 1)) + 1u}) : T{static_cast<uint64_t>(x)}} {};
+
+        /**
+         * @brief Преобразование из числа в прямом коде.
+         * @details Модуль, не умещающийся в диапазон, дает переполнение.
+         */
+        explicit TwosComplement(const T &x)
+        {
+            if (x.is_singular())
+            {
+                mBits = x;
+                return;
+            }
+            const bool negative = x.is_negative();
+            const T magnitude = x.abs();
+            const bool too_big = negative ? magnitude > mMaxPositive + T{1} : magnitude > mMaxPositive;
+            if (too_big)
+            {
+                mBits.set_overflow();
+                return;
+            }
+            mBits = negative ? T::neg_mod(magnitude) : magnitude;
+        }
+
+        /**
+         * @brief Преобразование в число в прямом коде. Всегда без потерь.
+         */
+        T to_unsigned() const
+        {
+            if (mBits.is_singular())
+            {
+                return mBits;
+            }
+            if (!is_negative())
+            {
+                return mBits;
+            }
+            T result = T::neg_mod(mBits);
+            result.mSign = true;
+            return result;
+        }
+
+        bool operator==(const TwosComplement &other) const
+        {
+            return mBits == other.mBits;
+        }
+
+        std::partial_ordering operator<=>(const TwosComplement &other) const
+        {
+            if (mBits.is_singular() || other.mBits.is_singular())
+            {
+                return std::partial_ordering::unordered;
+            }
+            const bool n1 = is_negative();
+            const bool n2 = other.is_negative();
+            if (n1 != n2)
+            {
+                return n2 <=> n1;
+            }
+            return mBits <=> other.mBits;
+        }
+
+        bool is_singular() const
+        {
+            return mBits.is_singular();
+        }
+
+        bool is_overflow() const
+        {
+            return mBits.is_overflow();
+        }
+
+        bool is_nan() const
+        {
+            return mBits.is_nan();
+        }
+
+        bool is_zero() const
+        {
+            return mBits.is_zero();
+        }
+
+        bool is_negative() const
+        {
+            return !mBits.is_singular() && (top_limb(mBits) >> 63) != 0;
+        }
+
+        /**
+         * @brief Сложение в дополнительном коде.
+         * @details Переполнение: знаки слагаемых совпадают, а знак суммы отличается.
+         */
+        TwosComplement operator+(const TwosComplement &rhs) const
+        {
+            TwosComplement result{*this};
+            T::add_carry(result.mBits, rhs.mBits);
+            const ULOW x = top_limb(mBits);
+            const ULOW y = top_limb(rhs.mBits);
+            const ULOW z = top_limb(result.mBits);
+            const ULOW overflow = ((x ^ z) & (y ^ z)) >> 63;
+            result.mBits.mSingular = twos_detail::propagate(mBits.mSingular, rhs.mBits.mSingular, overflow);
+            return result;
+        }
+
+        TwosComplement &operator+=(const TwosComplement &other)
+        {
+            *this = *this + other;
+            return *this;
+        }
+
+        /**
+         * @brief Вычитание в дополнительном коде.
+         * @details Переполнение: знаки операндов различны, а знак разности не совпадает со знаком уменьшаемого.
+         */
+        TwosComplement operator-(const TwosComplement &rhs) const
+        {
+            TwosComplement result{*this};
+            T::sub_borrow(result.mBits, rhs.mBits);
+            const ULOW x = top_limb(mBits);
+            const ULOW y = top_limb(rhs.mBits);
+            const ULOW z = top_limb(result.mBits);
+            const ULOW overflow = ((x ^ y) & (x ^ z)) >> 63;
+            result.mBits.mSingular = twos_detail::propagate(mBits.mSingular, rhs.mBits.mSingular, overflow);
+            return result;
+        }
+
+        TwosComplement &operator-=(const TwosComplement &other)
+        {
+            *this = *this - other;
+            return *this;
+        }
+
+        TwosComplement operator-() const
+        {
+            return TwosComplement{} - *this;
+        }
+
+        /**
+         * Возвращает строковое представление числа.
+         */
+        std::string value() const
+        {
+            return to_unsigned().value();
+        }
+
+    private:
+        static constexpr T mMaxPositive = T::get_max_value() >> 1; // Наибольшее положительное, 2^(W-1) - 1.
+
+        /**
+         * Старшая 64-битная цифра беззнаковой части.
+         */
+        template <typename X>
+        static constexpr ULOW top_limb(const X &x)
+        {
+            if constexpr (X::mLimbs == 2)
+            {
+                return x.mHigh;
+            }
+            else
+            {
+                return top_limb(x.mHigh);
+            }
+        }
+    }; // struct TwosComplement
+
+    using I256 = TwosComplement<GNumber<U128, 64>>;
+    using I512 = TwosComplement<GNumber<GNumber<U128, 64>, 128>>;
+}
@@ -1,6 +1,11 @@
 #include <iostream>
+#include <sstream> // std::ostringstream
+#include <iomanip> // std::setw
 #include "tests.hpp"
 #include "gnumber.hpp"
+#include "packed_vector.hpp"
+
+using namespace u128::literals;
 
 int main(int argc, char *argv[])
 {
@@ -16,6 +21,66 @@ int main(int argc, char *argv[])
         g_tests = std::stoull(argv[2]);
         std::cout << "You set the test selector: " << g_tests << '\n';
     }
+    {
+        // Вычисления при компиляции.
+        static_assert(340282366920938463463374607431768211455_u128 == U128::get_max_value());
+        static_assert(0xffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff_u128 == U128::get_max_value());
+        static_assert(0b101_u128 == U128{5} && 017_u128 == U128{15});
+        constexpr U128 a = 123456789012345678901234567890_u128;
+        static_assert(a * U128{3} == 370370367037037036703703703670_u128);
+        static_assert((a / U128{7}).first == 17636684144620811271604938270_u128);
+        static_assert((a >> 1) == (a / U128{2}).first && U128::divexact(a * U128{11}, U128{11}) == a);
+        static_assert(a.value() == "123456789012345678901234567890");
+        using U256 = GNumber<U128, 64>;
+        constexpr U256 b = 115792089237316195423570985008687907853269984665640564039457584007913129639935_u256;
+        static_assert(b == U256::get_max_value());
+        static_assert((b / U256{U128{3}, U128{0}}).first * U256{U128{3}, U128{0}} == b);
+    }
+    {
+        // Политики переполнения.
+        using U256 = GNumber<U128, 64>;
+        using W = Integer<U128, policy::Wrapping>;
+        using S = Integer<U256, policy::Saturating>;
+        constexpr U128 max = U128::get_max_value();
+        static_assert((W{max} + W{U128{2}}).get() == U128{1});
+        static_assert((W{U128{1}} - W{U128{2}}).get() == max);
+        static_assert((W{max} * W{max}).get() == U128{1});
+        static_assert((S{U256{7}} - S{U256{9}}).get() == U256{0});
+        static_assert((S{U256::get_max_value()} * S{U256{2}}).get() == U256::get_max_value());
+        static_assert((Integer<U128, policy::Unchecked>{U128{6}} * U128{7}).get() == U128{42});
+        static_assert((Integer<U128>{U128{1}} - U128{2}).get() == -U128{1});
+    }
+    {
+        // Операции с 64-битными операндами.
+        constexpr U128 max = U128::get_max_value();
+        static_assert(U128{5} + 3 == 8 && U128{5} - 7 == -2 && U128{5} * -3 == -15);
+        static_assert((max + 1u).is_overflow() && (U128{0} - 1u) == -1 && U128{1, 1} - 2u == U128{-1ull, 0});
+        static_assert(-U128{7} < 0 && U128{7} > -1 && U128{0, 1} > -1ull && !(U128{7} == -7));
+        static_assert(U128{0, 1} % 10 == 6 && U128{0, 1} % 10u == 6 && (U128{10} / 3).first == 3);
+        static_assert(U128{0}.dec() == -1 && (-U128{1}).inc() == 0 && U128{-1ull, 0}.inc() == U128{0, 1});
+        static_assert(U128{0, 1}.dec() == U128{-1ull, 0} && U128{max}.inc().is_overflow());
+    }
+    {
+        // Подсчет битов.
+        using U256 = GNumber<U128, 64>;
+        static_assert(countl_zero(U128{0}) == 128 && countr_zero(U128{0}) == 128 && bit_width(U128{0}) == 0);
+        static_assert(countl_zero(U128{0, 1}) == 63 && countr_zero(U128{0, 1}) == 64 && log2_floor(U128{0, 1}) == 64);
+        static_assert(popcount(U128::get_max_value()) == 128 && log2_floor(U128{0}) == -1);
+        static_assert(countl_zero(U256{0}) == 256 && countr_zero(U256{U128{0}, U128{0, 4}}) == 194);
+        static_assert(bit_width(U256{U128{0}, U128{1}}) == 129 && popcount(U256::get_max_value()) == 256);
+        static_assert((-U256{0} + U256{1}).is_positive() && (-U256{0}).dec() == -U256{1});
+    }
+    {
+        // Степени.
+        using U256 = GNumber<U128, 64>;
+        constexpr U128 m127 = (U128{1} << 127) - 1u;
+        static_assert(pow(U128{3}, 80) == 147808829414345923316083210206383297601_u128 && pow(U128{3}, 81).is_overflow());
+        static_assert(pow(-U128{2}, 3) == -8 && pow(U128{0}, 0) == 1 && pow(U256{2}, 255) == U256{1} << 255);
+        static_assert(pow_mod(U128{3}, U128{200}, U128{1000000007}) == 136318165);
+        static_assert(pow_mod(-U128{5}, U128{7, 1ull << 36}, m127) == 143761440721544502740076930112958005218_u128);
+        static_assert(pow_mod(U128{7}, U128{12345}, U128{0, 1ull << 36}) == 961162713373288692133717306055_u128);
+        static_assert(pow_mod(U256{3}, U256{200}, U256{1000000007}) == U256{136318165});
+    }
     {
         using U256 = GNumber<U128, 64>;
         U256 x{U128{5}, U128{3}};
@@ -34,6 +99,80 @@ int main(int argc, char *argv[])
         const auto &x_str = x.value();
         assert(x_str == "10");
     }
+    {
+        char buffer[64];
+        auto str = [&buffer](std::to_chars_result result)
+        {
+            assert(result.ec == std::errc{});
+            return std::string_view(buffer, result.ptr);
+        };
+        const U128 x = -0xfedcba98765432100123456789abcdef_u128;
+        assert(str(to_chars(buffer, buffer + sizeof(buffer), x, 16)) == "-fedcba98765432100123456789abcdef");
+        assert(str(to_chars(buffer, buffer + sizeof(buffer), U128{5}, 2)) == "101");
+        assert(str(to_chars(buffer, buffer + sizeof(buffer), U128::get_max_value(), 36)) == "f5lxx1zz5pnorynqglhzmsp33");
+        const auto &[end, ec] = to_chars(buffer, buffer + 38, U128::get_max_value());
+        assert(ec == std::errc::value_too_large && end == buffer + 38);
+        U128 inf;
+        inf.set_overflow();
+        assert(str(to_chars(buffer, buffer + sizeof(buffer), inf)) == "inf");
+        U128 y{1};
+        auto parse = [&y](std::string_view s)
+        {
+            const auto result = from_chars(s.data(), s.data() + s.size(), y);
+            return std::pair{result.ptr - s.data(), result.ec};
+        };
+        assert((parse("340282366920938463463374607431768211455") == std::pair{39l, std::errc{}}) && y == U128::get_max_value());
+        assert((parse("340282366920938463463374607431768211456") == std::pair{39l, std::errc::result_out_of_range}) && y.is_overflow());
+        assert((parse("-123x") == std::pair{4l, std::errc{}}) && y == (U128{123, 0, Sign{true}}));
+        assert((parse("-x") == std::pair{0l, std::errc::invalid_argument}) && y == (U128{123, 0, Sign{true}}));
+        assert((parse("-0") == std::pair{2l, std::errc{}}) && y.is_zero() && !y.is_negative());
+        assert(to_hex(x) == "-fedcba98765432100123456789abcdef");
+        assert(to_binary(U128{0}) == "0" && to_binary(U128{1, 1}) == "1" + std::string(63, '0') + "1");
+        assert(from_hex<U128>("-FEDCBA98765432100123456789abcdef") == x);
+        assert(from_binary<U128>("-" + std::string(100, '0') + "101") == (U128{5, 0, Sign{true}}));
+        assert(from_hex<U128>("1" + std::string(32, '0')).is_overflow());
+        assert(from_hex<U128>("").is_nan() && from_hex<U128>("12g").is_nan());
+        using U256 = GNumber<U128, 64>;
+        const U256 z{U128{0, 0x8000000000000000ull}, U128{-1ull, 1}};
+        assert(u128::to_hex(z) == "1ffffffffffffffff80000000000000000000000000000000");
+        assert(u128::from_hex<U256>(u128::to_hex(z)) == z);
+        assert(str(to_chars(buffer, buffer + sizeof(buffer), z, 32)) == "7vvvvvvvvvvvvs0000000000000000000000000");
+        std::ostringstream os;
+        os << x << ' ' << std::hex << GNumber<U128, 64>{U128{255}, U128{0}} << ' ' << std::dec << std::setw(4) << U128{7};
+        assert(os.str() == "-338770000845734292516042252062085074415 ff    7");
+    }
+    {
+        std::array<U128, 6> column;
+        const std::string_view text = "12,-0012345678901234567890123456789\r\n\n x1 ,340282366920938463463374607431768211456,-,7";
+        assert(parse_decimal_column(text, column) == 6);
+        assert(column[0] == U128{12});
+        assert(column[1] == -12345678901234567890123456789_u128);
+        assert(column[2].is_nan() && column[3].is_overflow() && column[4].is_nan() && column[5] == U128{7});
+        assert(parse_decimal_column(text, std::span(column).first(2)) == 2);
+        char buffer[16];
+        const std::array<U128, 3> values{U128{1}, U128{23, 0, Sign{true}}, U128{0}};
+        const auto [end, ec] = format_decimal_column(values, buffer, buffer + sizeof(buffer), ',');
+        assert(ec == std::errc{} && std::string_view(buffer, end) == "1,-23,0,");
+        assert(format_decimal_column(values, buffer, buffer + 7).ec == std::errc::value_too_large);
+        std::array<U128, 2> special;
+        special[0].set_overflow();
+        special[1].set_nan();
+        const auto [special_end, special_ec] = format_decimal_column(special, buffer, buffer + sizeof(buffer), ',');
+        const std::string_view special_text(buffer, special_end);
+        assert(special_ec == std::errc{} && special_text == "inf,nan,");
+        assert(parse_decimal_column(special_text, column) == 2 && column[0].is_overflow() && column[1].is_nan());
+    }
+    {
+        // Границы порций по 19 цифр.
+        assert(U128{0}.value() == "0");
+        assert((U128{0, 0, Sign{true}}.value() == "0"));
+        assert(U128{9'999'999'999'999'999'999ull}.value() == "9999999999999999999");
+        assert(U128{10'000'000'000'000'000'000ull}.value() == "10000000000000000000");
+        assert((U128{-1ull, -1ull, Sign{true}}.value() == "-340282366920938463463374607431768211455"));
+        using U256 = GNumber<U128, 64>;
+        constexpr U256 x = -100000000000000000000000000000000000000_u256;
+        assert(x.value() == "-100000000000000000000000000000000000000");
+    }
     {
         using U256 = GNumber<U128, 64>;
         U256 x1{U128{0}, U128{0, 65532}};
@@ -122,6 +261,24 @@ int main(int argc, char *argv[])
         assert(q_str == "2");
         assert(r_str == "0");
     }
+    {
+        PackedVector v(3);
+        U128 x{5, 7, Sign{true}};
+        U128 y{1};
+        y.set_overflow();
+        assert(v.is_raw());
+        v.set(0, x);
+        v.set(2, y);
+        assert(!v.is_raw());
+        assert(v.at(0) == x && v.at(0).is_negative());
+        assert(v.at(1).is_zero());
+        assert(v.at(2).is_overflow());
+        v.set(0, x.abs());
+        v.set(2, U128{3});
+        assert(v.is_raw());
+        assert(v.raw_data()[0].mHigh == 7 && v.raw_data()[2].mLow == 3);
+        assert(U128::from_raw(x.abs().raw()) == x.abs());
+    }
 
     if (g_tests & 0x1)
     {
@@ -196,6 +353,160 @@ int main(int argc, char *argv[])
         std::cout << "Ok\n";
     }
 
+    if (g_tests & 0b10000000)
+    {
+        std::cout << "Run random two's complement test...\n";
+        test_twos_complement_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b1000000000)
+    {
+        std::cout << "Run random precomputed divisor test...\n";
+        test_divisor_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b10000000000)
+    {
+        std::cout << "Run random quotient/remainder/divisibility test...\n";
+        test_div_mod_divides_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b100000000000)
+    {
+        std::cout << "Run random exact division test...\n";
+        test_divexact_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b1000000000000)
+    {
+        std::cout << "Run random wide multiplication test...\n";
+        test_mul_wide_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b1000000000000000000000000000)
+    {
+        std::cout << "Run random squaring test...\n";
+        test_sqr_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b10000000000000000000000000000)
+    {
+        std::cout << "Run random to_chars test...\n";
+        test_to_chars_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b10000000000000)
+    {
+        std::cout << "Run random to_chars/from_chars roundtrip test...\n";
+        test_chars_roundtrip_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b100000000000000)
+    {
+        std::cout << "Run random decimal column test...\n";
+        test_decimal_column_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b1000000000000000)
+    {
+        std::cout << "Run random overflow policies test...\n";
+        test_policies_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b10000000000000000)
+    {
+        std::cout << "Run random mixed operands test...\n";
+        test_mixed_operands_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b100000000000000000)
+    {
+        std::cout << "Run random bit scan test...\n";
+        test_bit_scan_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b1000000000000000000)
+    {
+        std::cout << "Run random wide isqrt test...\n";
+        test_isqrt_wide_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b10000000000000000000)
+    {
+        std::cout << "Run random primality test...\n";
+        test_is_prime_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b100000000000000000000)
+    {
+        std::cout << "Run random probable prime test...\n";
+        test_probable_prime_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b1000000000000000000000)
+    {
+        std::cout << "Run random Montgomery U128 test...\n";
+        test_montgomery_u128_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b10000000000000000000000)
+    {
+        std::cout << "Run random Barrett reduction test...\n";
+        test_barrett_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b100000000000000000000000)
+    {
+        std::cout << "Run random power test...\n";
+        test_pow_mod_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b100000000)
+    {
+        std::cout << "Run U128 division benchmark...\n";
+        benchmark_division_u128_semi_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b1000000000000000000000000)
+    {
+        std::cout << "Run decimal column benchmark...\n";
+        benchmark_decimal_column_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b10000000000000000000000000)
+    {
+        std::cout << "Run U512 probable prime benchmark...\n";
+        benchmark_probable_prime_u512_randomly(N);
+        std::cout << "Ok\n";
+    }
+
+    if (g_tests & 0b100000000000000000000000000)
+    {
+        std::cout << "Run modular multiplication benchmark...\n";
+        benchmark_mul_mod_randomly(N);
+        std::cout << "Ok\n";
+    }
+
     std::cout << "All is ok!" << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,525 @@
+#pragma once
+
+#include <cassert>     // assert
+#include <cstdint>     // int64_t
+#include <type_traits> // std::decay_t, std::is_same_v
+#include <algorithm>   // std::max
+#include <bit>         // std::bit_width
+
+#include "u128.hpp"
+#include "gnumber.hpp"
+
+/**
+ * Контексты модульной арифметики с общим интерфейсом: to/from (перевод в представление контекста и обратно),
+ * one, mul, sqr, add, sub, modulus. Значения в представлении контекста - неотрицательные числа, меньшие модуля.
+ */
+namespace u128
+{
+    /**
+     * @brief Модульная арифметика с приведением полного произведения делением.
+     * @details Представление совпадает с обычным: to и from - просто приведение по модулю.
+     * Подходит для любого, в том числе четного, модуля.
+     */
+    template <typename T>
+    class PlainModulus
+    {
+    public:
+        explicit constexpr PlainModulus(const T &m)
+            : mModulus{m.abs()}
+        {
+            assert(!m.is_zero() && !m.is_singular());
+        }
+
+        constexpr const T &modulus() const
+        {
+            return mModulus;
+        }
+
+        constexpr T to(const T &x) const
+        {
+            return T::mod(x, mModulus);
+        }
+
+        constexpr T from(const T &x) const
+        {
+            return x;
+        }
+
+        constexpr T one() const
+        {
+            return to(T{1});
+        }
+
+        constexpr T mul(const T &x, const T &y) const
+        {
+            const auto &[low, high] = T::mul_wide(x, y);
+            return reduce(low, high);
+        }
+
+        constexpr T sqr(const T &x) const
+        {
+            const auto &[low, high] = T::sqr_wide(x);
+            return reduce(low, high);
+        }
+
+        constexpr T add(T x, const T &y) const
+        {
+            if (T::add_carry(x, y) != 0 || !(x < mModulus))
+            {
+                T::sub_borrow(x, mModulus);
+            }
+            return x;
+        }
+
+        constexpr T sub(T x, const T &y) const
+        {
+            if (T::sub_borrow(x, y) != 0)
+            {
+                T::add_carry(x, mModulus);
+            }
+            return x;
+        }
+
+    private:
+        T mModulus;
+
+        constexpr T reduce(const T &low, const T &high) const
+        {
+            return T::mod_wide(low, high, mModulus);
+        }
+    };
+
+    /**
+     * @brief Модульная арифметика с приведением по Барретту для любого, в том числе четного, модуля m.
+     * @details Модуль нормализуется сдвигом d = m * 2^s до старшего единичного бита, и один раз предвычисляется
+     * обратная величина v = floor((2^(2W) - 1) / d) - 2^W, W - ширина T. Приведение произведения (алгоритм
+     * Меллера-Гранлунда) - одно полное и одно младшее умножение, не более двух условных поправок и сдвиги, без деления.
+     * Представление совпадает с обычным. Выгоднее Монтгомери, когда модуль часто меняется.
+     */
+    template <typename T>
+    class Barrett
+    {
+        static constexpr int W = 64 * T::mLimbs;
+
+    public:
+        explicit constexpr Barrett(const T &m)
+            : mModulus{m.abs()}
+        {
+            assert(!m.is_zero() && !m.is_singular());
+            mShift = countl_zero(mModulus);
+            mNormalized = mModulus << mShift;
+            mReciprocal = reciprocal(mNormalized);
+            mOne = reduce(T{1}, T{0});
+        }
+
+        constexpr const T &modulus() const
+        {
+            return mModulus;
+        }
+
+        /**
+         * @brief Остаток неотрицательного числа x по модулю.
+         */
+        constexpr T to(const T &x) const
+        {
+            return reduce(x, T{0});
+        }
+
+        constexpr T from(const T &x) const
+        {
+            return x;
+        }
+
+        constexpr T one() const
+        {
+            return mOne;
+        }
+
+        constexpr T mul(const T &x, const T &y) const
+        {
+            const auto &[low, high] = T::mul_wide(x, y);
+            return reduce(low, high);
+        }
+
+        constexpr T sqr(const T &x) const
+        {
+            const auto &[low, high] = T::sqr_wide(x);
+            return reduce(low, high);
+        }
+
+        constexpr T add(T x, const T &y) const
+        {
+            if (T::add_carry(x, y) != 0 || !(x < mModulus))
+            {
+                T::sub_borrow(x, mModulus);
+            }
+            return x;
+        }
+
+        constexpr T sub(T x, const T &y) const
+        {
+            if (T::sub_borrow(x, y) != 0)
+            {
+                T::add_carry(x, mModulus);
+            }
+            return x;
+        }
+
+        /**
+         * @brief Остаток от деления high * 2^W + low на модуль при high < m.
+         */
+        constexpr T reduce(const T &low, const T &high) const
+        {
+            if constexpr (std::is_same_v<T, U128>)
+            {
+                if (mModulus.mHigh == 0 && high.is_zero())
+                {
+                    return U128{reduce_short(low)};
+                }
+            }
+            // Нормализованное делимое u1 * 2^W + u0, u1 < d.
+            const T u1 = mShift == 0 ? high : (high << mShift) | (low >> (W - mShift));
+            const T u0 = low << mShift;
+            // Оценка частного q1 и остатка r: истинный остаток - r, r + d или r - d.
+            auto [q0, q1] = T::mul_wide(mReciprocal, u1);
+            T::add_carry(q1, u1, T::add_carry(q0, u0));
+            T::add_carry(q1, T{1});
+            T r = u0;
+            T::sub_borrow(r, T::mul_low(q1, mNormalized));
+            if (q0 < r)
+            {
+                T::add_carry(r, mNormalized);
+            }
+            if (!(r < mNormalized))
+            {
+                T::sub_borrow(r, mNormalized);
+            }
+            return r >> mShift;
+        }
+
+    private:
+        T mModulus;
+        T mNormalized; // m * 2^s, старший бит - единичный.
+        T mReciprocal; // floor((2^(2W) - 1) / d) - 2^W.
+        T mOne;
+        int mShift;
+
+        /**
+         * @brief Остаток 128-битного числа по 64-битному модулю: две 64-битные цифры по тому же алгоритму.
+         * @details Старшие слова нормализованного модуля и обратной величины - их 64-битные аналоги.
+         */
+        constexpr ULOW reduce_short(const U128 &x) const
+        {
+            const int s = mShift - 64;
+            const ULOW d = mNormalized.mHigh;
+            const ULOW v = mReciprocal.mHigh;
+            auto step = [d, v](ULOW u1, ULOW u0) -> ULOW
+            {
+                U128 q = U128::mult64(v, u1);
+                U128::add_carry(q, U128{u0, u1});
+                ULOW r = u0 - (q.mHigh + 1) * d;
+                if (r > q.mLow)
+                {
+                    r += d;
+                }
+                if (r >= d)
+                {
+                    r -= d;
+                }
+                return r;
+            };
+            const ULOW u2 = s == 0 ? 0 : x.mHigh >> (64 - s);
+            const ULOW u1 = s == 0 ? x.mHigh : (x.mHigh << s) | (x.mLow >> (64 - s));
+            return step(step(u2, u1), x.mLow << s) >> s;
+        }
+
+        /**
+         * @brief Обратная величина нормализованного d: деление "в столбик" числа (2^W - 1 - d) * 2^W + 2^W - 1
+         * на d, по одному биту частного за шаг. Выполняется один раз на модуль.
+         */
+        static constexpr T reciprocal(const T &d)
+        {
+            T r = T::get_max_value();
+            T::sub_borrow(r, d);
+            T q{0};
+            for (int i = 0; i < W; ++i)
+            {
+                const ULOW top = T::add_carry(r, r, 1);
+                const ULOW bit = top != 0 || !(r < d);
+                if (bit != 0)
+                {
+                    T::sub_borrow(r, d);
+                }
+                T::add_carry(q, q, bit);
+            }
+            return q;
+        }
+    };
+
+    /**
+     * @brief Значение небольшого знакового числа в представлении контекста.
+     */
+    template <typename Context>
+    constexpr auto to_context(const Context &ctx, int64_t x)
+    {
+        using T = std::decay_t<decltype(ctx.modulus())>;
+        const T &y = ctx.to(T{U128::magnitude(x)});
+        return x < 0 ? ctx.sub(T{0}, y) : y;
+    }
+
+    /**
+     * @brief Половина числа по нечетному модулю: x / 2 в представлении контекста.
+     */
+    template <typename Context, typename T>
+    constexpr T half(const Context &ctx, T x)
+    {
+        if (countr_zero(x) > 0)
+        {
+            return x >> 1;
+        }
+        const bool carry = T::add_carry(x, ctx.modulus()) != 0;
+        x = x >> 1;
+        return carry ? x | (T{1} << (64 * T::mLimbs - 1)) : x;
+    }
+
+    /**
+     * @brief Степень x^e в представлении контекста: метод скользящего окна слева направо.
+     * @details Ширина окна k выбирается по длине показателя; предвычисляются нечетные степени x, x^3, ..., x^(2^k - 1).
+     * Всего около log2(e) возведений в квадрат и log2(e) / (k + 1) умножений.
+     */
+    template <typename Context, typename T>
+    constexpr T pow(const Context &ctx, const T &x, const T &e)
+    {
+        const int bits = bit_width(e);
+        if (bits == 0)
+        {
+            return ctx.one();
+        }
+        const int k = bits <= 24 ? 1 : bits <= 80 ? 3 : bits <= 240 ? 4 : 5;
+        T odd_powers[16]{x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x}; // x^(2i + 1).
+        const T x2 = ctx.sqr(x);
+        for (int i = 1; i < (1 << (k - 1)); ++i)
+        {
+            odd_powers[i] = ctx.mul(odd_powers[i - 1], x2);
+        }
+        T result = ctx.one();
+        bool is_one = true;
+        for (int i = bits - 1; i >= 0;)
+        {
+            if (!test_bit(e, i))
+            {
+                result = is_one ? result : ctx.sqr(result);
+                --i;
+                continue;
+            }
+            // Окно [j, i] длины не больше k, оканчивающееся единичным битом.
+            int j = std::max(i - k + 1, 0);
+            while (!test_bit(e, j))
+            {
+                ++j;
+            }
+            unsigned window = 0;
+            for (int b = i; b >= j; --b)
+            {
+                window = (window << 1) | test_bit(e, b);
+                result = is_one ? result : ctx.sqr(result);
+            }
+            result = is_one ? odd_powers[window >> 1] : ctx.mul(result, odd_powers[window >> 1]);
+            is_one = false;
+            i = j - 1;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Модульная арифметика Монтгомери для нечетного 128-битного модуля m, R = 2^128.
+     * @details Представление числа x - x * R mod m. Предвычисляются -m^(-1) mod R и R^2 mod m;
+     * приведение произведения (REDC) - два умножения 128x128 и одно условное вычитание, без деления.
+     */
+    class MontgomeryU128
+    {
+    public:
+        explicit constexpr MontgomeryU128(const U128 &m)
+            : mModulus{m.abs()}
+        {
+            assert(!m.is_singular() && (mModulus.mLow & 1) == 1);
+            // Обратный по Ньютону: m * m = 1 mod 8, каждый шаг удваивает число верных бит: 3 -> 6 -> ... -> 192.
+            U128 inverse = mModulus;
+            for (int i = 0; i < 6; ++i)
+            {
+                U128 correction{2};
+                U128::sub_borrow(correction, U128::mul_low(mModulus, inverse));
+                inverse = U128::mul_low(inverse, correction);
+            }
+            mInverse = U128{0};
+            U128::sub_borrow(mInverse, inverse);
+            mOne = U128::mod_wide(U128{0}, U128{1}, mModulus);
+            const auto &[low, high] = U128::sqr_wide(mOne);
+            mR2 = U128::mod_wide(low, high, mModulus);
+        }
+
+        constexpr const U128 &modulus() const
+        {
+            return mModulus;
+        }
+
+        /**
+         * @brief Перевод неотрицательного числа в представление Монтгомери: x * R mod m.
+         * @details x может быть не меньше модуля: x * R^2 < R * m, что достаточно для REDC.
+         */
+        constexpr U128 to(const U128 &x) const
+        {
+            return mul(x, mR2);
+        }
+
+        constexpr U128 from(const U128 &x) const
+        {
+            return reduce(x, U128{0});
+        }
+
+        constexpr U128 to_mont(const U128 &x) const
+        {
+            return to(x);
+        }
+
+        constexpr U128 from_mont(const U128 &x) const
+        {
+            return from(x);
+        }
+
+        constexpr U128 one() const
+        {
+            return mOne;
+        }
+
+        constexpr U128 mul(const U128 &x, const U128 &y) const
+        {
+            const auto &[low, high] = U128::mul_wide(x, y);
+            return reduce(low, high);
+        }
+
+        constexpr U128 sqr(const U128 &x) const
+        {
+            const auto &[low, high] = U128::sqr_wide(x);
+            return reduce(low, high);
+        }
+
+        constexpr U128 add(U128 x, const U128 &y) const
+        {
+            if (U128::add_carry(x, y) != 0 || !(x < mModulus))
+            {
+                U128::sub_borrow(x, mModulus);
+            }
+            return x;
+        }
+
+        constexpr U128 sub(U128 x, const U128 &y) const
+        {
+            if (U128::sub_borrow(x, y) != 0)
+            {
+                U128::add_carry(x, mModulus);
+            }
+            return x;
+        }
+
+        /**
+         * @brief Степень x^e в представлении Монтгомери.
+         */
+        constexpr U128 pow(const U128 &x, const U128 &e) const
+        {
+            return u128::pow(*this, x, e);
+        }
+
+    private:
+        U128 mModulus;
+        U128 mInverse; // -m^(-1) mod R.
+        U128 mOne;     // R mod m.
+        U128 mR2;      // R^2 mod m.
+
+        /**
+         * @brief REDC: (high * R + low) / R mod m при high < m.
+         */
+        constexpr U128 reduce(U128 low, U128 high) const
+        {
+            const auto &[tlow, thigh] = U128::mul_wide(U128::mul_low(low, mInverse), mModulus);
+            // Младшая половина суммы равна нулю, от нее нужен только перенос.
+            const ULOW carry = U128::add_carry(low, tlow);
+            if (U128::add_carry(high, thigh, carry) != 0 || !(high < mModulus))
+            {
+                U128::sub_borrow(high, mModulus);
+            }
+            return high;
+        }
+    };
+
+    /**
+     * @brief Степень x^e возведением в квадрат слева направо: O(log e) умножений.
+     * @details Переполнение обнаруживается по старшей половине полного произведения и сразу прерывает вычисление.
+     * Результат отрицателен для отрицательного x и нечетного e; сингулярное x возвращается без изменений.
+     */
+    template <typename T>
+    constexpr T pow(const T &x, ULOW e)
+    {
+        if (x.is_singular())
+        {
+            return x;
+        }
+        const T base = x.abs();
+        T result{1};
+        for (int i = std::bit_width(e) - 1; i >= 0; --i)
+        {
+            auto product = T::sqr_wide(result);
+            if (((e >> i) & 1) != 0 && product.second.is_zero())
+            {
+                product = T::mul_wide(product.first, base);
+            }
+            if (!product.second.is_zero())
+            {
+                T overflow{0};
+                overflow.set_overflow();
+                return overflow;
+            }
+            result = product.first;
+        }
+        result.mSign = x.is_negative() && (e & 1) != 0 && !result.is_zero();
+        return result;
+    }
+
+    /**
+     * @brief Модульная степень base^exp mod m для любой ширины: скользящее окно в подходящем контексте.
+     * @details Нечетный 128-битный модуль - арифметика Монтгомери, четный - Барретта. Для GNumber - приведение
+     * делением по 64-битным цифрам: на этих ширинах оно быстрее Барретта (см. замеры скорости).
+     * @param exp Неотрицательный показатель.
+     * @return Неотрицательный остаток; основание может быть отрицательным.
+     */
+    template <typename T>
+    constexpr T pow_mod(const T &base, const T &exp, const T &m)
+    {
+        assert(!exp.is_negative() && !exp.is_singular());
+        if (base.is_singular())
+        {
+            return base;
+        }
+        const T modulus = m.abs();
+        T x = T::mod_wide(base, T{0}, modulus);
+        if (base.is_negative() && !x.is_zero())
+        {
+            T r = modulus;
+            T::sub_borrow(r, x);
+            x = r;
+        }
+        if constexpr (std::is_same_v<T, U128>)
+        {
+            if ((modulus.mLow & 1) == 1)
+            {
+                const MontgomeryU128 ctx{modulus};
+                return ctx.from(ctx.pow(ctx.to(x), exp));
+            }
+            return pow(Barrett<U128>{modulus}, x, exp);
+        }
+        else
+        {
+            return pow(PlainModulus<T>{modulus}, x, exp);
+        }
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint> // uint8_t
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+#include "u128.hpp"
+
+namespace u128
+{
+    /**
+     * Компактный массив 128-битных чисел.
+     * Значения хранятся в "сыром" виде по 16 байт (U128Raw), а знак и флаги
+     * переполнения/NaN упакованы в отдельный байтовый массив: 17 байт на число вместо sizeof(U128).
+     * Если ни у одного элемента флаги не установлены (is_raw()), то raw_data() можно
+     * обрабатывать как непрерывный массив 16-байтных беззнаковых чисел.
+     */
+    class PackedVector
+    {
+    public:
+        PackedVector() = default;
+
+        explicit PackedVector(std::size_t size)
+            : mValues(size, U128Raw{0, 0}), mFlags(size, 0) {}
+
+        std::size_t size() const
+        {
+            return mValues.size();
+        }
+
+        bool empty() const
+        {
+            return mValues.empty();
+        }
+
+        void resize(std::size_t size)
+        {
+            for (std::size_t i = size; i < mFlags.size(); ++i)
+            {
+                mFlagged -= mFlags[i] != 0;
+            }
+            mValues.resize(size, U128Raw{0, 0});
+            mFlags.resize(size, 0);
+        }
+
+        void clear()
+        {
+            mValues.clear();
+            mFlags.clear();
+            mFlagged = 0;
+        }
+
+        /**
+         * @brief Возвращает элемент массива.
+         */
+        U128 operator[](std::size_t i) const
+        {
+            return unpack(mValues[i], mFlags[i]);
+        }
+
+        /**
+         * @brief Возвращает элемент массива с проверкой индекса.
+         */
+        U128 at(std::size_t i) const
+        {
+            return unpack(mValues.at(i), mFlags.at(i));
+        }
+
+        /**
+         * @brief Записывает элемент массива.
+         */
+        void set(std::size_t i, const U128 &x)
+        {
+            const uint8_t flags = pack(x);
+            mFlagged += (flags != 0) - (mFlags[i] != 0);
+            mValues[i] = U128Raw{x.mLow, x.mHigh};
+            mFlags[i] = flags;
+        }
+
+        void push_back(const U128 &x)
+        {
+            mValues.push_back(U128Raw{0, 0});
+            mFlags.push_back(0);
+            set(size() - 1, x);
+        }
+
+        /**
+         * @brief Нет ли у всех элементов знака и флагов.
+         */
+        bool is_raw() const
+        {
+            return mFlagged == 0;
+        }
+
+        /**
+         * @brief Непрерывный массив "сырых" значений; знак и флаги не учитываются.
+         */
+        const U128Raw *raw_data() const
+        {
+            return mValues.data();
+        }
+
+        U128Raw *raw_data()
+        {
+            return mValues.data();
+        }
+
+    private:
+        static constexpr uint8_t SIGN_BIT = 1;
+        static constexpr uint8_t OVERFLOW_BIT = 2;
+        static constexpr uint8_t NAN_BIT = 4;
+
+        static uint8_t pack(const U128 &x)
+        {
+            return (x.mSign() ? SIGN_BIT : 0) |
+                   (x.mSingular.IsOverflow() ? OVERFLOW_BIT : 0) |
+                   (x.mSingular.IsNaN() ? NAN_BIT : 0);
+        }
+
+        static U128 unpack(const U128Raw &value, uint8_t flags)
+        {
+            U128 result{value.mLow, value.mHigh, Sign{(flags & SIGN_BIT) != 0}};
+            result.mSingular = Singular{(flags & OVERFLOW_BIT) != 0, (flags & NAN_BIT) != 0};
+            return result;
+        }
+
+        std::vector<U128Raw> mValues;
+        std::vector<uint8_t> mFlags;
+        std::size_t mFlagged = 0; // Количество элементов с ненулевыми флагами.
+    };
+}
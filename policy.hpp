@@ -0,0 +1,270 @@
+#pragma once
+
+#include <cassert>     // assert
+#include <compare>     // std::partial_ordering
+#include <type_traits> // std::is_same_v
+
+#include "u128.hpp"
+#include "gnumber.hpp"
+
+/**
+ * Политики переполнения для беззнаковой арифметики U128 и GNumber.
+ */
+namespace u128
+{
+    namespace policy
+    {
+        /**
+         * Обычная арифметика классов: знак, флаги переполнения и NaN.
+         */
+        struct Checked
+        {
+        };
+
+        /**
+         * Арифметика по модулю 2^W, без флагов.
+         */
+        struct Wrapping
+        {
+        };
+
+        /**
+         * Насыщение: переполнение дает максимальное значение, отрицательная разность - ноль.
+         */
+        struct Saturating
+        {
+        };
+
+        /**
+         * Переполнение не ожидается: перенос сложения и вычитания проверяется через assert,
+         * переполнение умножения - только с U128_DEBUG_POLICY (полное произведение дороже младшей половины).
+         */
+        struct Unchecked
+        {
+        };
+    }
+
+    /**
+     * @brief Операции над числами T с заданной политикой переполнения.
+     * @details Кроме Checked, операнды - неотрицательные несингулярные числа; операции сводятся к
+     * ядрам add_carry, sub_borrow и mul_low без проверок знаков и флагов на каждом уровне рекурсии GNumber.
+     */
+    template <typename T, typename Policy>
+    struct Arithmetic;
+
+    template <typename T>
+    struct Arithmetic<T, policy::Checked>
+    {
+        static constexpr T add(const T &x, const T &y)
+        {
+            return x + y;
+        }
+
+        static constexpr T sub(const T &x, const T &y)
+        {
+            return x - y;
+        }
+
+        static constexpr T mul(const T &x, const T &y)
+        {
+            return x * y;
+        }
+
+        static constexpr T div(const T &x, const T &y)
+        {
+            return T::div(x, y);
+        }
+
+        static constexpr T mod(const T &x, const T &y)
+        {
+            return T::mod(x, y);
+        }
+    };
+
+    template <typename T>
+    struct Arithmetic<T, policy::Wrapping>
+    {
+        static constexpr T add(T x, const T &y)
+        {
+            T::add_carry(x, y);
+            return x;
+        }
+
+        static constexpr T sub(T x, const T &y)
+        {
+            T::sub_borrow(x, y);
+            return x;
+        }
+
+        static constexpr T mul(const T &x, const T &y)
+        {
+            return T::mul_low(x, y);
+        }
+
+        static constexpr T div(const T &x, const T &y)
+        {
+            return T::div(x, y);
+        }
+
+        static constexpr T mod(const T &x, const T &y)
+        {
+            return T::mod(x, y);
+        }
+    };
+
+    template <typename T>
+    struct Arithmetic<T, policy::Saturating>
+    {
+        static constexpr T add(T x, const T &y)
+        {
+            return T::add_carry(x, y) != 0 ? T::get_max_value() : x;
+        }
+
+        static constexpr T sub(T x, const T &y)
+        {
+            return T::sub_borrow(x, y) != 0 ? T{0} : x;
+        }
+
+        static constexpr T mul(const T &x, const T &y)
+        {
+            const auto &[low, high] = T::mul_wide(x, y);
+            return high.is_zero() ? low : T::get_max_value();
+        }
+
+        static constexpr T div(const T &x, const T &y)
+        {
+            return T::div(x, y);
+        }
+
+        static constexpr T mod(const T &x, const T &y)
+        {
+            return T::mod(x, y);
+        }
+    };
+
+    template <typename T>
+    struct Arithmetic<T, policy::Unchecked>
+    {
+        static constexpr T add(T x, const T &y)
+        {
+            [[maybe_unused]] const auto carry = T::add_carry(x, y);
+            assert(carry == 0);
+            return x;
+        }
+
+        static constexpr T sub(T x, const T &y)
+        {
+            [[maybe_unused]] const auto borrow = T::sub_borrow(x, y);
+            assert(borrow == 0);
+            return x;
+        }
+
+        static constexpr T mul(const T &x, const T &y)
+        {
+#ifdef U128_DEBUG_POLICY
+            const auto &[low, high] = T::mul_wide(x, y);
+            assert(high.is_zero());
+            return low;
+#else
+            return T::mul_low(x, y);
+#endif
+        }
+
+        static constexpr T div(const T &x, const T &y)
+        {
+            return T::div(x, y);
+        }
+
+        static constexpr T mod(const T &x, const T &y)
+        {
+            return T::mod(x, y);
+        }
+    };
+
+    /**
+     * @brief Число T, арифметика которого определяется политикой переполнения Policy.
+     * @details Для политик, отличных от Checked, хранится неотрицательное несингулярное значение,
+     * и операторы не формируют знак и флаги. Пример: Integer<U256, policy::Wrapping> - хеш-арифметика по модулю 2^256.
+     */
+    template <typename T, typename Policy = policy::Checked>
+    class Integer
+    {
+        using Ops = Arithmetic<T, Policy>;
+
+    public:
+        constexpr Integer() = default;
+
+        constexpr Integer(const T &x) : mValue{x}
+        {
+            assert((std::is_same_v<Policy, policy::Checked> || (!x.is_singular() && !x.is_negative())));
+        }
+
+        constexpr const T &get() const
+        {
+            return mValue;
+        }
+
+        constexpr Integer operator+(const Integer &other) const
+        {
+            return Integer{Ops::add(mValue, other.mValue)};
+        }
+
+        constexpr Integer operator-(const Integer &other) const
+        {
+            return Integer{Ops::sub(mValue, other.mValue)};
+        }
+
+        constexpr Integer operator*(const Integer &other) const
+        {
+            return Integer{Ops::mul(mValue, other.mValue)};
+        }
+
+        constexpr Integer operator/(const Integer &other) const
+        {
+            return Integer{Ops::div(mValue, other.mValue)};
+        }
+
+        constexpr Integer operator%(const Integer &other) const
+        {
+            return Integer{Ops::mod(mValue, other.mValue)};
+        }
+
+        constexpr Integer &operator+=(const Integer &other)
+        {
+            return *this = *this + other;
+        }
+
+        constexpr Integer &operator-=(const Integer &other)
+        {
+            return *this = *this - other;
+        }
+
+        constexpr Integer &operator*=(const Integer &other)
+        {
+            return *this = *this * other;
+        }
+
+        constexpr Integer &operator/=(const Integer &other)
+        {
+            return *this = *this / other;
+        }
+
+        constexpr Integer &operator%=(const Integer &other)
+        {
+            return *this = *this % other;
+        }
+
+        constexpr bool operator==(const Integer &other) const
+        {
+            return mValue == other.mValue;
+        }
+
+        constexpr std::partial_ordering operator<=>(const Integer &other) const
+        {
+            return mValue <=> other.mValue;
+        }
+
+    private:
+        T mValue{};
+    };
+}
@@ -1,27 +1,33 @@
 #pragma once
 
 #include <compare>
+#include <cstdint> // uint8_t
 
 struct Sign
 {
-    int mSign = 0;
+#ifdef U128_COMPACT_FLAGS
+    using Storage = uint8_t; // Компактное хранение: один байт.
+#else
+    using Storage = int;
+#endif
+    Storage mSign = 0;
     constexpr explicit Sign() = default;
     constexpr Sign(const Sign &other) = default;
     constexpr Sign(Sign &&other) = default;
     constexpr Sign(bool value) : mSign{value} {};
     constexpr Sign &operator=(const Sign &other) = default;
     constexpr Sign &operator=(Sign &&other) = default;
-    Sign &operator^(const Sign &other)
+    constexpr Sign &operator^(const Sign &other)
     {
         this->mSign = operator()() ^ other.operator()();
         return *this;
     }
-    bool operator()() const { return mSign != 0; }
-    void operator-()
+    constexpr bool operator()() const { return mSign != 0; }
+    constexpr void operator-()
     {
         mSign = 1 - operator()();
     }
-    bool operator==(const Sign &other) const
+    constexpr bool operator==(const Sign &other) const
     {
         return mSign == other.mSign ? true : ((operator()() && other.operator()()) || (!operator()() && !other.operator()()));
     }
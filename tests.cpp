@@ -1,5 +1,6 @@
 #include <iostream>
 #include <random>
+#include <chrono>
 #include <cassert>
 #include "tests.hpp"
 #include "solver.hpp"
@@ -9,6 +10,11 @@ static auto const seed = std::random_device{}();
 
 static auto const internal_step = 1ll << 15;
 
+/**
+ * Приемник результатов замеров скорости: не дает компилятору выбросить вычисления.
+ */
+static volatile ULOW benchmark_sink = 0;
+
 /***
  * Генератор случайных чисел.
  */
@@ -30,6 +36,23 @@ auto roll_bool = [urbg = std::mt19937{seed},
     return distr(urbg) % 2;
 };
 
+/**
+ * Случайное число случайной разрядности, часто - степень двойки.
+ */
+static ULOW roll_bits()
+{
+    return roll_bool() ? roll_ulow() >> (roll_uint() % 64) : ULOW{1} << (roll_uint() % 64);
+}
+
+/**
+ * Случайная 64-битная цифра, часто - нулевая или близкая к граничным значениям.
+ */
+static ULOW roll_limb()
+{
+    const ULOW x = roll_bool() ? roll_ulow() >> (roll_uint() % 64) : 0;
+    return roll_bool() ? x : ULOW{0} - x;
+}
+
 /**
  * Конструирует два 128-битных числа {B + M*A, D + M*C}.
  */
@@ -55,6 +78,51 @@ static std::pair<U512, U512> construct_two_512bit_numbers(const Quadrupole &q1,
                           U512{D1, D2, Sign{s.s2}});
 }
 
+/**
+ * Число Python high * 2^bits | low; ссылки на high и low освобождаются.
+ */
+static PyObject *join_halves(PyObject *high, PyObject *low, long bits)
+{
+    PyObject *shift = PyLong_FromLong(bits);
+    PyObject *shifted = PyNumber_Lshift(high, shift);
+    PyObject *result = PyNumber_Or(shifted, low);
+    Py_XDECREF(shift);
+    Py_XDECREF(shifted);
+    Py_XDECREF(high);
+    Py_XDECREF(low);
+    return result;
+}
+
+/**
+ * Модуль числа как число Python: собирается из 64-битных цифр сдвигами, независимо от to_chars и value().
+ */
+static PyObject *to_python_magnitude(const U128 &x)
+{
+    return join_halves(PyLong_FromUnsignedLongLong(x.mHigh), PyLong_FromUnsignedLongLong(x.mLow), 64);
+}
+
+template <typename L, unsigned int H>
+static PyObject *to_python_magnitude(const GNumber<L, H> &x)
+{
+    return join_halves(to_python_magnitude(x.mHigh), to_python_magnitude(x.mLow), 2 * H);
+}
+
+/**
+ * Число Python из числа С++.
+ */
+template <typename T>
+static PyObject *to_python(const T &x)
+{
+    PyObject *magnitude = to_python_magnitude(x);
+    if (!x.is_negative())
+    {
+        return magnitude;
+    }
+    PyObject *result = PyNumber_Negative(magnitude);
+    Py_XDECREF(magnitude);
+    return result;
+}
+
 template <typename T>
 PythonCaller<T>::PythonCaller()
 {
@@ -74,8 +142,8 @@ template <typename T>
 PyObject *PythonCaller<T>::Divide(T X, T Y) const
 {
     const char *pythonScript = "quotient = nominator // denominator\n";
-    PyDict_SetItemString(mLocalDictionary, "nominator", PyLong_FromString(X.value().c_str(), nullptr, 10));
-    PyDict_SetItemString(mLocalDictionary, "denominator", PyLong_FromString(Y.value().c_str(), nullptr, 10));
+    PyDict_SetItemString(mLocalDictionary, "nominator", to_python(X));
+    PyDict_SetItemString(mLocalDictionary, "denominator", to_python(Y));
     PyRun_String(pythonScript, Py_file_input, mGlobalDictionary, mLocalDictionary);
     return PyDict_GetItemString(mLocalDictionary, "quotient");
 }
@@ -84,8 +152,8 @@ template <typename T>
 PyObject *PythonCaller<T>::Multiply(T X, T Y) const
 {
     const char *pythonScript = "c = a * b\n";
-    PyDict_SetItemString(mLocalDictionary, "a", PyLong_FromString(X.value().c_str(), nullptr, 10));
-    PyDict_SetItemString(mLocalDictionary, "b", PyLong_FromString(Y.value().c_str(), nullptr, 10));
+    PyDict_SetItemString(mLocalDictionary, "a", to_python(X));
+    PyDict_SetItemString(mLocalDictionary, "b", to_python(Y));
     PyRun_String(pythonScript, Py_file_input, mGlobalDictionary, mLocalDictionary);
     return PyDict_GetItemString(mLocalDictionary, "c");
 }
@@ -94,7 +162,7 @@ template <typename T>
 PyObject *PythonCaller<T>::ISqrt(T X) const
 {
     const char *pythonScript = "import math;y = math.isqrt(x)\n";
-    PyDict_SetItemString(mLocalDictionary, "x", PyLong_FromString(X.value().c_str(), nullptr, 10));
+    PyDict_SetItemString(mLocalDictionary, "x", to_python(X));
     PyRun_String(pythonScript, Py_file_input, mGlobalDictionary, mLocalDictionary);
     return PyDict_GetItemString(mLocalDictionary, "y");
 }
@@ -856,3 +924,1214 @@ void qs_factorization_tests()
         }
     }
 }
+
+void test_twos_complement_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    {
+        const I128 max = I128::get_max_value();
+        const I128 min = I128::get_min_value();
+        assert((max + I128{1}).is_overflow());
+        assert((min - I128{1}).is_overflow());
+        assert((-min).is_overflow());
+        assert(!(min + max).is_singular() && (min + max) == I128{-1});
+        assert(I128{min.to_u128()} == min);
+        assert(min.value() == "-170141183460469231731687303715884105728");
+        assert((I128{U128{0, 1ull << 63}}).is_overflow());
+        assert(I256{-7} + I256{5} == I256{-2});
+        assert((I256{-7} - I256{5}).value() == "-12");
+        I128 nan{1};
+        nan.set_nan();
+        assert((nan + (max + I128{1})).is_nan() && ((max + I128{1}) - nan).is_nan() && (nan + max).is_nan());
+        assert((max + I128{1} + I128{1}).is_overflow() && !(max + I128{1} + I128{1}).is_nan());
+        I256 nan256{1};
+        nan256.mBits.set_nan();
+        const I256 overflow256 = -I256{U256::get_max_value() >> 1} - I256{2};
+        assert(overflow256.is_overflow() && (nan256 + overflow256).is_nan() && (overflow256 - nan256).is_nan());
+        assert((overflow256 + I256{1}).is_overflow() && I256{-1}.is_negative() && !I256{1}.is_negative());
+    }
+    auto roll_i128 = []() -> U128
+    { // Модуль меньше 2^126, чтобы сумма и разность гарантированно умещались в I128.
+        return U128{roll_ulow(), roll_ulow() >> 2, Sign{roll_bool()}};
+    };
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x = roll_i128();
+        const U128 y = roll_i128();
+        const I128 a{x};
+        const I128 b{y};
+        is_ok &= a.to_u128() == x && b.to_u128() == y;
+        is_ok &= (a + b).to_u128() == x + y;
+        is_ok &= (a - b).to_u128() == x - y;
+        is_ok &= ((a < b) == (x < y)) && ((a == b) == (x == y));
+        const I256 c{U256{x.abs(), U128{roll_ulow(), roll_ulow() >> 2}, Sign{roll_bool()}}};
+        const I256 d{U256{y.abs(), U128{roll_ulow(), roll_ulow() >> 2}, Sign{roll_bool()}}};
+        is_ok &= (c + d).to_unsigned() == c.to_unsigned() + d.to_unsigned();
+        is_ok &= (c - d).to_unsigned() == c.to_unsigned() - d.to_unsigned();
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", y: " << y.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_divisor_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x{roll_ulow(), roll_bits(), Sign{roll_bool()}};
+        const ULOW d64 = roll_bits() | 1u << (roll_uint() % 4);
+        const Divisor<ULOW> divisor64{d64};
+        is_ok &= divisor64.divmod(x) == x / d64;
+        const U128 d128{roll_ulow(), roll_bool() ? roll_bits() : 0, Sign{roll_bool()}};
+        if (!d128.is_zero())
+        {
+            const Divisor<U128> divisor128{d128};
+            is_ok &= divisor128.divmod(x) == x / d128;
+            is_ok &= divisor128.divides(x * d128.mLow) == (x * d128.mLow / d128).second.is_zero();
+        }
+        const U256 X{U128{roll_ulow(), roll_ulow()}, U128{roll_ulow(), roll_bits()}, Sign{roll_bool()}};
+        const U256 D{U128{roll_ulow(), roll_bits()}, U128{roll_bool() ? roll_bits() : 0, 0}};
+        if (!D.is_zero())
+        {
+            const Divisor<U256> divisor256{D};
+            is_ok &= divisor256.divmod(X) == X / D;
+        }
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", d64: " << d64 << ", d128: " << d128.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+    {
+        const Divisor<U128> one{U128{1}};
+        assert(one.div(U128{12345, 678}) == (U128{12345, 678}));
+        const Divisor<U128> big{U128::get_max_value()};
+        assert(big.divmod(U128::get_max_value()) == std::make_pair(U128{1}, U128{0}));
+        const Divisor<U128> power{U128{0, 1}};
+        assert(power.divides(U128{0, 7}) && !power.divides(U128{1, 7}));
+    }
+}
+
+void test_div_mod_divides_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x{roll_bits(), roll_bool() ? roll_bits() : 0, Sign{roll_bool()}};
+        U128 d{roll_bits(), roll_uint() % 4 == 0 ? roll_bits() : 0, Sign{roll_bool()}};
+        if (d.is_zero())
+            continue;
+        for (const U128 &y : {x, x * d.mLow})
+        {
+            if (y.is_singular())
+                continue;
+            const auto &[q, r] = y / d;
+            is_ok &= U128::div(y, d) == q;
+            is_ok &= U128::mod(y, d) == r;
+            is_ok &= U128::divides(y, d) == r.is_zero();
+            const U256 Y{y.abs(), U128{roll_bool() ? roll_ulow() : 0}, y.mSign};
+            const U256 D{d.abs(), U128{0}, d.mSign};
+            const auto &[Q, R] = Y / D;
+            is_ok &= U256::div(Y, D) == Q;
+            is_ok &= U256::mod(Y, D) == R;
+            is_ok &= U256::divides(Y, D) == R.is_zero();
+            if (!is_ok)
+            {
+                std::cout << "y: " << y.value() << ", d: " << d.value() << ", Y: " << Y.value() << std::endl;
+            }
+            assert(is_ok);
+        }
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_divexact_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 q{roll_bits(), roll_bool() ? roll_bits() >> 32 : 0, Sign{roll_bool()}};
+        const U128 d{roll_bits() << (roll_uint() % 16), roll_uint() % 4 == 0 ? roll_bits() >> 48 : 0, Sign{roll_bool()}};
+        const U128 x = q * d;
+        if (d.is_zero() || x.is_singular())
+            continue;
+        is_ok &= U128::divexact(x, d) == (x / d).first;
+        const U256 Q{U128{roll_ulow(), roll_bits() >> 32}, U128{0}, Sign{roll_bool()}};
+        const U256 D{d.abs(), U128{roll_bool() ? roll_bits() : 0}, d.mSign};
+        const U256 X = Q * D;
+        if (!X.is_singular())
+        {
+            is_ok &= U256::divexact(X, D) == Q;
+            const U512 X512{X.abs(), U256{0}, X.mSign};
+            const U512 D512{D.abs(), U256{0}, D.mSign};
+            is_ok &= U512::divexact(X512 * D512, D512) == X512;
+        }
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", d: " << d.value() << ", X: " << X.value() << ", D: " << D.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+/**
+ * Эталон: умножение "в столбик" 32-битными цифрами; числа - 64-битные цифры, младшие - первыми.
+ */
+static std::vector<ULOW> multiply_by_columns(const std::vector<ULOW> &x, const std::vector<ULOW> &y)
+{
+    std::vector<uint32_t> a, b;
+    for (ULOW v : x)
+    {
+        a.push_back(static_cast<uint32_t>(v));
+        a.push_back(static_cast<uint32_t>(v >> 32));
+    }
+    for (ULOW v : y)
+    {
+        b.push_back(static_cast<uint32_t>(v));
+        b.push_back(static_cast<uint32_t>(v >> 32));
+    }
+    std::vector<uint32_t> c(a.size() + b.size(), 0);
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        ULOW carry = 0;
+        for (size_t j = 0; j < b.size(); ++j)
+        {
+            const ULOW t = ULOW{a[i]} * b[j] + c[i + j] + carry;
+            c[i + j] = static_cast<uint32_t>(t);
+            carry = t >> 32;
+        }
+        c[i + b.size()] = static_cast<uint32_t>(carry);
+    }
+    std::vector<ULOW> result;
+    for (size_t i = 0; i < c.size(); i += 2)
+        result.push_back(ULOW{c[i]} | (ULOW{c[i + 1]} << 32));
+    return result;
+}
+
+void test_mul_wide_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x{roll_limb(), roll_limb()};
+        const U128 y{roll_limb(), roll_limb()};
+        const auto &[low, high] = U128::mul_wide(x, y);
+        is_ok &= std::vector<ULOW>{low.mLow, low.mHigh, high.mLow, high.mHigh} ==
+                 multiply_by_columns({x.mLow, x.mHigh}, {y.mLow, y.mHigh});
+        is_ok &= U128::mulhi(x, y) == high;
+        const U256 X{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}};
+        const U256 Y{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}};
+        const auto &[LOW, HIGH] = U256::mul_wide(X, Y);
+        is_ok &= std::vector<ULOW>{LOW.mLow.mLow, LOW.mLow.mHigh, LOW.mHigh.mLow, LOW.mHigh.mHigh,
+                                   HIGH.mLow.mLow, HIGH.mLow.mHigh, HIGH.mHigh.mLow, HIGH.mHigh.mHigh} ==
+                 multiply_by_columns({X.mLow.mLow, X.mLow.mHigh, X.mHigh.mLow, X.mHigh.mHigh},
+                                     {Y.mLow.mLow, Y.mLow.mHigh, Y.mHigh.mLow, Y.mHigh.mHigh});
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", y: " << y.value() << ", X: " << X.value() << ", Y: " << Y.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_sqr_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x{roll_limb(), roll_limb()};
+        const auto &[low, high] = U128::sqr_wide(x);
+        is_ok &= std::vector<ULOW>{low.mLow, low.mHigh, high.mLow, high.mHigh} ==
+                 multiply_by_columns({x.mLow, x.mHigh}, {x.mLow, x.mHigh});
+        is_ok &= U128{x.mLow, 0, Sign{true}}.sqr() == U128{x.mLow} * U128{x.mLow};
+        is_ok &= x.mHigh == 0 ? x.sqr() == x * x : x.sqr().is_overflow() && (x * x).is_overflow();
+        const U256 X{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}};
+        const auto &[LOW, HIGH] = U256::sqr_wide(X);
+        is_ok &= std::vector<ULOW>{LOW.mLow.mLow, LOW.mLow.mHigh, LOW.mHigh.mLow, LOW.mHigh.mHigh,
+                                   HIGH.mLow.mLow, HIGH.mLow.mHigh, HIGH.mHigh.mLow, HIGH.mHigh.mHigh} ==
+                 multiply_by_columns({X.mLow.mLow, X.mLow.mHigh, X.mHigh.mLow, X.mHigh.mHigh},
+                                     {X.mLow.mLow, X.mLow.mHigh, X.mHigh.mLow, X.mHigh.mHigh});
+        const U256 X_low{X.mLow, U128{0}, Sign{roll_bool()}};
+        const U256 X_low_copy = X_low;
+        is_ok &= X_low.sqr() == X_low * X_low_copy;
+        is_ok &= X_low * X_low == X_low * X_low_copy;
+        const U256 X_copy = X;
+        is_ok &= X.mHigh.is_zero() ? X.sqr() == X * X_copy : X.sqr().is_overflow() && (X * X_copy).is_overflow();
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", X: " << X.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_chars_roundtrip_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    auto roundtrip = [](const auto &x, int base) -> bool
+    {
+        using T = std::decay_t<decltype(x)>;
+        char buffer[8 * sizeof(T) + 2];
+        const auto [end, ec] = u128::to_chars(buffer, buffer + sizeof(buffer), x, base);
+        T y{1};
+        const auto [ptr, ec2] = u128::from_chars(buffer, end, y, base);
+        return ec == std::errc{} && ec2 == std::errc{} && ptr == end && y == x && (x.is_zero() || y.mSign == x.mSign);
+    };
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const int base = roll_bool() ? 10 : 2 + roll_uint() % 35;
+        const U128 x{roll_limb(), roll_limb(), Sign{roll_bool()}};
+        const U256 X{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}, Sign{roll_bool()}};
+        const U512 Y{X.abs(), U256{U128{roll_limb(), roll_limb()}, U128{0}}, Sign{roll_bool()}};
+        is_ok &= roundtrip(x, base);
+        is_ok &= roundtrip(X, base);
+        is_ok &= roundtrip(Y, base);
+        if (!Y.mHigh.is_zero())
+        { // Число, не умещающееся в 256 бит, дает переполнение.
+            char buffer[8 * sizeof(U512) + 2];
+            const auto [end, _] = u128::to_chars(buffer, buffer + sizeof(buffer), Y, base);
+            U256 y{1};
+            const auto [ptr, ec] = u128::from_chars(buffer, end, y, base);
+            is_ok &= ec == std::errc::result_out_of_range && ptr == end && y.is_overflow();
+        }
+        if (!is_ok)
+        {
+            std::cout << "base: " << base << ", x: " << x.value() << ", X: " << X.value() << ", Y: " << Y.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_to_chars_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    PythonCaller<U512> caller;
+    // Эталон: десятичная запись - repr числа Python, остальные основания - bin/oct/hex с префиксом.
+    auto check = [&caller](const auto &x, int base) -> bool
+    {
+        char buffer[520];
+        const auto [end, ec] = to_chars(buffer, buffer + sizeof(buffer), x, base);
+        const std::string digits(buffer, end);
+        PyObject *value = to_python(x);
+        bool is_ok = ec == std::errc{};
+        if (base == 10)
+        {
+            is_ok &= caller.Compare(value, digits.c_str());
+        }
+        else
+        {
+            const bool negative = digits.front() == '-';
+            std::string reference{"'"};
+            reference.append(negative ? "-" : "").append(base == 2 ? "0b" : base == 8 ? "0o" : "0x");
+            reference.append(digits, negative).append("'");
+            PyObject *text = PyNumber_ToBase(value, base);
+            is_ok &= caller.Compare(text, reference.c_str());
+            Py_XDECREF(text);
+        }
+        Py_XDECREF(value);
+        return is_ok;
+    };
+    constexpr int bases[]{10, 16, 2, 8};
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const int base = bases[roll_uint() % 4];
+        const U128 x{roll_limb(), roll_limb(), Sign{roll_bool()}};
+        const U256 X{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}, Sign{roll_bool()}};
+        const U512 Y{X.abs(), U256{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}}, Sign{roll_bool()}};
+        is_ok &= check(x, base) && check(X, base) && check(Y, base);
+        if (!is_ok)
+        {
+            std::cout << "base: " << base << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_decimal_column_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    constexpr std::size_t column_size = 1024;
+    std::vector<U128> values(column_size);
+    std::vector<U128> parsed(column_size + 1);
+    std::vector<char> text(column_size * 42);
+    long long counter = 0;
+    long long external_iterations = 0;
+    while (external_iterations < N)
+    {
+        for (auto &x : values)
+        {
+            x = U128{roll_ulow() >> (roll_uint() % 64), roll_bool() ? roll_ulow() >> (roll_uint() % 64) : 0, Sign{roll_bool()}};
+            switch (roll_uint() % 16)
+            { // Изредка - сингулярные значения.
+            case 0:
+                x.set_nan();
+                break;
+            case 1:
+                x.set_overflow();
+                break;
+            }
+        }
+        const char delimiter = roll_bool() ? '\n' : ',';
+        const auto [end, ec] = format_decimal_column(values, text.data(), text.data() + text.size(), delimiter);
+        assert(ec == std::errc{});
+        const std::size_t n = parse_decimal_column(std::string_view(text.data(), end - text.data()), parsed);
+        bool is_ok = n == column_size;
+        for (std::size_t i = 0; is_ok && i < column_size; ++i)
+        {
+            const U128 &x = values[i];
+            const U128 &y = parsed[i];
+            is_ok &= x.is_singular() ? y.is_nan() == x.is_nan() && y.is_overflow() == x.is_overflow()
+                                     : y == x && (x.is_zero() || y.mSign == x.mSign);
+            if (!is_ok)
+            {
+                std::cout << "i: " << i << ", x: " << values[i].value() << ", parsed: " << parsed[i].value() << std::endl;
+            }
+        }
+        assert(is_ok);
+        counter += column_size;
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_policies_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    auto check = [](const auto &x, const auto &y) -> bool
+    {
+        using T = std::decay_t<decltype(x)>;
+        using Wrapping = Integer<T, policy::Wrapping>;
+        using Saturating = Integer<T, policy::Saturating>;
+        using Unchecked = Integer<T, policy::Unchecked>;
+        const T &sum = x + y;
+        const T &difference = x - y;
+        const T &product = x * y;
+        const T &max = T::get_max_value();
+        bool is_ok = true;
+        is_ok &= (Wrapping{x} + Wrapping{y}).get() == T::add_mod(x, y);
+        is_ok &= (Wrapping{x} - Wrapping{y}).get() == T::sub_mod(x, y);
+        is_ok &= (Wrapping{x} * Wrapping{y}).get() == T::mult_mod(x, y);
+        is_ok &= (Saturating{x} + Saturating{y}).get() == (sum.is_overflow() ? max : sum);
+        is_ok &= (Saturating{x} - Saturating{y}).get() == (difference.is_negative() ? T{0} : difference);
+        is_ok &= (Saturating{x} * Saturating{y}).get() == (product.is_overflow() ? max : product);
+        if (!sum.is_overflow())
+            is_ok &= (Unchecked{x} + Unchecked{y}).get() == sum;
+        if (!difference.is_negative())
+            is_ok &= (Unchecked{x} - Unchecked{y}).get() == difference;
+        if (!product.is_overflow())
+            is_ok &= (Unchecked{x} * Unchecked{y}).get() == product;
+        if (!y.is_zero())
+            is_ok &= (Wrapping{x} / Wrapping{y}).get() == (x / y).first && (Wrapping{x} % Wrapping{y}).get() == (x / y).second;
+        // Ядра с переносом согласованы со знаковыми операторами.
+        T z = x;
+        is_ok &= (T::add_carry(z, y) != 0) == sum.is_overflow() && (sum.is_overflow() || z == sum);
+        z = x;
+        is_ok &= (T::sub_borrow(z, y) != 0) == difference.is_negative();
+        return is_ok;
+    };
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const unsigned int shift = roll_uint() % 128;
+        const U128 x = U128{roll_limb(), roll_limb()} >> (roll_uint() % 128);
+        const U128 y = U128{roll_limb(), roll_limb()} >> shift;
+        is_ok &= check(x, y);
+        const U256 X = U256{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}} >> (roll_uint() % 256);
+        const U256 Y = U256{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}} >> (2 * shift);
+        is_ok &= check(X, Y);
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", y: " << y.value() << ", X: " << X.value() << ", Y: " << Y.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_mixed_operands_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    auto same = [](const auto &a, const auto &b) -> bool
+    { // Значения при переполнении не сравниваются.
+        return a.is_overflow() ? b.is_overflow() : a == b;
+    };
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x{roll_limb(), roll_bool() ? roll_limb() : 0, Sign{roll_bool()}};
+        const ULOW y = roll_limb();
+        const int64_t z = static_cast<int64_t>(roll_limb());
+        const U128 Y{y};
+        const U128 Z{U128::magnitude(z), 0, Sign{z < 0}};
+        is_ok &= same(x + y, x + Y) && same(x - y, x - Y) && same(x * y, x * Y);
+        is_ok &= same(x + z, x + Z) && same(x - z, x - Z) && same(x * z, x * Z);
+        is_ok &= (x == y) == (x == Y) && (x < y) == (x < Y) && (x > y) == (x > Y);
+        is_ok &= (x == z) == (x == Z) && (x < z) == (x < Z) && (x > z) == (x > Z);
+        if (y != 0)
+            is_ok &= x / y == x / Y && x % y == U128::mod(x, Y).mLow;
+        if (z != 0)
+            is_ok &= x / z == x / Z && x % z == U128::mod(x, Z).mLow;
+        U128 a = x;
+        U128 b = x;
+        is_ok &= same(a.inc(), x + U128{1}) && same(b.dec(), x - U128{1});
+        const U256 X{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_bool() ? roll_limb() : 0}, Sign{roll_bool()}};
+        U256 A = X;
+        U256 B = X;
+        is_ok &= same(A.inc(), X + U256{1}) && same(B.dec(), X - U256{1});
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", y: " << y << ", z: " << z << ", X: " << X.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_bit_scan_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    // Эталон: побитовый просмотр 64-битных цифр.
+    auto check = [](const auto &x) -> bool
+    {
+        using T = std::decay_t<decltype(x)>;
+        std::array<ULOW, T::mLimbs> limbs;
+        T::store_limbs(x, limbs.data());
+        int leading = 0;
+        int trailing = 0;
+        int ones = 0;
+        bool seen = false;
+        for (int i = T::mLimbs * 64 - 1; i >= 0; --i)
+        {
+            const bool bit = (limbs[i / 64] >> (i % 64)) & 1;
+            seen |= bit;
+            leading += !seen;
+            ones += bit;
+        }
+        for (int i = 0; i < T::mLimbs * 64 && ((limbs[i / 64] >> (i % 64)) & 1) == 0; ++i)
+        {
+            trailing++;
+        }
+        return countl_zero(x) == leading && countr_zero(x) == trailing && popcount(x) == ones &&
+               bit_width(x) == T::mLimbs * 64 - leading && log2_floor(x) == T::mLimbs * 64 - leading - 1;
+    };
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x{roll_limb(), roll_limb(), Sign{roll_bool()}};
+        const U256 X{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}};
+        const U512 Y{X, U256{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}}};
+        is_ok &= check(x) && check(X) && check(Y);
+        is_ok &= u128::utils::num_of_digits(x) == static_cast<int>(x.abs().value().size());
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", X: " << X.value() << ", Y: " << Y.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_isqrt_wide_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    // r = floor(sqrt(x)): r^2 <= x < (r + 1)^2; корень точный только для квадратов.
+    auto check = [](const auto &x) -> bool
+    {
+        bool exact;
+        const auto &r = u128::utils::isqrt(x, exact);
+        auto r1 = r;
+        r1.inc();
+        const auto &r1_sqr = r1.sqr();
+        return r.sqr() <= x && (r1_sqr.is_overflow() || r1_sqr > x) && exact == (r.sqr() == x) &&
+               u128::utils::is_square(x) == exact && u128::utils::is_square(r.sqr());
+    };
+    long long counter = 0;
+    long long external_iterations = 0;
+    bool is_ok = true;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x{roll_limb(), roll_limb()};
+        const U256 X{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}};
+        const U512 Y{X, U256{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}}};
+        is_ok &= check(x) && check(X) && check(Y);
+        is_ok &= check(x.mHigh == 0 ? x.sqr() : U128{x.mHigh}.sqr()) && check(X.mHigh.is_zero() ? X.sqr() : U256{X.mHigh, U128{0}}.sqr());
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", X: " << X.value() << ", Y: " << Y.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_is_prime_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    using namespace u128::utils;
+    auto is_prime_reference = [](ULOW x) -> bool
+    { // Пробное деление: 0 и 1 не отвергаются, как и в is_prime.
+        for (ULOW d = 2; d * d <= x; ++d)
+        {
+            if (x % d == 0)
+                return false;
+        }
+        return true;
+    };
+    auto roll_prime = []() -> U128
+    { // Случайное простое число до 2^64.
+        U128 p{roll_ulow() | 1};
+        while (!is_prime(p))
+            p = p + 2u;
+        return p;
+    };
+    // Сильные псевдопростые по первым простым основаниям: 2, ..., 2..37, 2..41.
+    bool is_ok = !is_prime(U128{2047}) && !is_prime(U128{3215031751ull}) && !is_prime(U128{3825123056546413051ull});
+    is_ok &= !is_prime(U128{0xe92817f9fc85b7e5ull, 0x437aull}) && !is_prime(U128{0x51adc5b22410a5fdull, 0x2be69ull});
+    // Простые Мерсенна 2^61 - 1, 2^89 - 1, 2^127 - 1.
+    is_ok &= is_prime((U128{1} << 61) - 1u) && is_prime((U128{1} << 89) - 1u) && is_prime((U128{1} << 127) - 1u);
+    is_ok &= !is_prime(U128{4}) && is_prime(U128{2}) && is_prime(-U128{7});
+    assert(is_ok);
+    long long counter = 0;
+    long long external_iterations = 0;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const ULOW x = roll_ulow() >> (40 + roll_uint() % 24);
+        is_ok &= is_prime(U128{x}) == is_prime_reference(x);
+        U128 low{roll_ulow(), roll_ulow()};
+        U128 high{roll_ulow(), roll_ulow()};
+        U128 m{roll_ulow() >> (roll_uint() % 64), roll_bool() ? roll_ulow() >> (roll_uint() % 64) : 0};
+        if (!m.is_zero())
+            is_ok &= U128::mod_wide(low, high, m) == (U256{low, high} / U256{m, U128{0}}).second.mLow;
+        if (counter % 64 == 0)
+        {
+            const U128 p = roll_prime();
+            const U128 q = roll_prime();
+            is_ok &= !is_prime(p * q) && !is_prime(p * p);
+        }
+        if (!is_ok)
+        {
+            std::cout << "x: " << x << ", low: " << low.value() << ", high: " << high.value() << ", m: " << m.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_probable_prime_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    using namespace u128::utils;
+    using U1024 = GNumber<U512, 256>;
+    using U2048 = GNumber<U1024, 512>;
+    auto roll_prime = []() -> U128
+    { // Случайное 128-битное простое число.
+        U128 p{roll_ulow() | 1, roll_ulow() | (1ull << 63)};
+        while (!is_prime(p))
+            p = p + 2u;
+        return p;
+    };
+    // Простые 2^255 - 19, 2^256 - 189, 2^511 - 187, 2^1024 - 105, 2^2048 - 1557.
+    const U256 p255 = (U256{1} << 255) - U256{19};
+    bool is_ok = is_probable_prime(p255) && is_probable_prime(U256::get_max_value() - U256{188});
+    is_ok &= is_probable_prime((U512{1} << 511) - U512{187}) && is_probable_prime(U1024::get_max_value() - U1024{104});
+    is_ok &= is_probable_prime(U2048::get_max_value() - U2048{1556});
+    is_ok &= !is_probable_prime(p255 - U256{2}) && !is_probable_prime(U1024::get_max_value() - U1024{102});
+    // Сильные псевдопростые по основанию 2: отсеиваются тестом Люка.
+    is_ok &= !is_probable_prime(U256{2047}) && !is_probable_prime(U256{3215031751ull}) && !is_probable_prime(U256{3825123056546413051ull});
+    assert(is_ok);
+    long long counter = 0;
+    long long external_iterations = 0;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x{roll_limb() | 1, roll_limb()};
+        // is_prime(1) == true сохранено для совместимости, поэтому единица не сравнивается.
+        is_ok &= x == 1u || (is_probable_prime(U256{x, U128{0}}) == is_prime(x) && is_probable_prime(x) == is_prime(x));
+        const U256 low{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}};
+        const U256 high{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}};
+        const U256 m{U128{roll_limb(), roll_limb()}, U128{roll_limb(), roll_limb()}};
+        if (!m.is_zero())
+            is_ok &= U256::mod_wide(low, high, m) == (U512{low, high} / U512{m, U256{0}}).second.mLow;
+        if (counter % 256 == 0)
+        {
+            const U128 p = roll_prime();
+            const U128 q = roll_prime();
+            const U256 P{p, U128{0}};
+            is_ok &= is_probable_prime(P) && !is_probable_prime(P * U256{q, U128{0}}) && !is_probable_prime(P * P);
+        }
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", low: " << low.value() << ", high: " << high.value() << ", m: " << m.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_montgomery_u128_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    long long counter = 0;
+    long long external_iterations = 0;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 m{roll_limb() | 1, roll_limb()};
+        const MontgomeryU128 mont{m};
+        const PlainModulus<U128> plain{m};
+        const U128 x = U128::mod(U128{roll_limb(), roll_limb()}, m);
+        const U128 y = U128::mod(U128{roll_limb(), roll_limb()}, m);
+        const U128 e{roll_limb(), roll_bool() ? roll_limb() : 0};
+        const U128 xm = mont.to_mont(x);
+        const U128 ym = mont.to_mont(y);
+        bool is_ok = mont.from_mont(xm) == x && xm < m && mont.from(mont.one()) == U128::mod(U128{1}, m);
+        is_ok &= mont.from(mont.mul(xm, ym)) == plain.mul(x, y);
+        is_ok &= mont.from(mont.sqr(xm)) == plain.sqr(x);
+        is_ok &= mont.from(mont.add(xm, ym)) == plain.add(x, y);
+        is_ok &= mont.from(mont.sub(xm, ym)) == plain.sub(x, y);
+        if (counter % 16 == 0)
+        {
+            is_ok &= mont.from(mont.pow(xm, e)) == u128::pow(plain, x, e);
+        }
+        if (!is_ok)
+        {
+            std::cout << "m: " << m.value() << ", x: " << x.value() << ", y: " << y.value() << ", e: " << e.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_barrett_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    auto roll_u128 = []() -> U128
+    {
+        return U128{roll_limb(), roll_limb()};
+    };
+    auto roll_u512 = [&roll_u128]() -> U512
+    {
+        return U512{U256{roll_u128(), roll_u128()}, U256{roll_u128(), roll_u128()}};
+    };
+    // Сравнение с приведением делением: операнды - остатки, z - произвольное неотрицательное число.
+    auto check = [](const auto &m, const auto &x, const auto &y, const auto &z) -> bool
+    {
+        using T = std::decay_t<decltype(m)>;
+        const Barrett<T> barrett{m};
+        const PlainModulus<T> plain{m};
+        const T a = plain.to(x);
+        const T b = plain.to(y);
+        return barrett.to(z) == plain.to(z) && barrett.one() == plain.one() && barrett.mul(a, b) == plain.mul(a, b) &&
+               barrett.sqr(a) == plain.sqr(a) && barrett.add(a, b) == plain.add(a, b) && barrett.sub(a, b) == plain.sub(a, b);
+    };
+    bool is_ok = true;
+    for (const U128 &m : {U128{1}, U128{2}, U128{3}, U128{1} << 63, U128{1} << 127, U128::get_max_value()})
+    {
+        is_ok &= check(m, U128::get_max_value(), m - 1u, U128{12345});
+    }
+    assert(is_ok);
+    long long counter = 0;
+    long long external_iterations = 0;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 m = roll_bool() ? roll_u128() : U128{roll_limb()}; // Часто - 64-битный модуль.
+        if (!m.is_zero())
+        {
+            is_ok &= check(m, roll_u128(), roll_u128(), roll_u128());
+        }
+        const U256 m256{roll_u128(), roll_u128()};
+        if (!m256.is_zero())
+        {
+            is_ok &= check(m256, U256{roll_u128(), roll_u128()}, U256{roll_u128(), roll_u128()}, U256{roll_u128(), roll_u128()});
+        }
+        if (counter % 16 == 0)
+        {
+            const U512 m512 = roll_u512();
+            if (!m512.is_zero())
+            {
+                is_ok &= check(m512, roll_u512(), roll_u512(), roll_u512());
+            }
+        }
+        if (!is_ok)
+        {
+            std::cout << "m: " << m.value() << ", m256: " << m256.value() << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void test_pow_mod_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    using U1024 = GNumber<U512, 256>;
+    using U2048 = GNumber<U1024, 512>;
+    auto same = [](const auto &a, const auto &b) -> bool
+    {
+        return a.is_overflow() ? b.is_overflow() : a == b;
+    };
+    // Малая теорема Ферма для простых 2^255 - 19, 2^1024 - 105 и 2^2048 - 1557.
+    const U256 p256 = (U256{1} << 255) - U256{19};
+    const U1024 p1024 = U1024::get_max_value() - U1024{104};
+    const U2048 p2048 = U2048::get_max_value() - U2048{1556};
+    bool is_ok = pow_mod(U256{2}, p256 - U256{1}, p256) == U256{1};
+    is_ok &= pow_mod(-U1024{3}, p1024 - U1024{1}, p1024) == U1024{1};
+    is_ok &= pow_mod(U2048{5}, p2048 - U2048{1}, p2048) == U2048{1};
+    is_ok &= pow(U2048{3}, 1292) == pow(pow(U2048{3}, 646), 2) && pow(U2048{3}, 1293).is_overflow();
+    assert(is_ok);
+    long long counter = 0;
+    long long external_iterations = 0;
+    while (external_iterations < N)
+    {
+        ++counter;
+        const U128 x{roll_limb(), roll_bool() ? roll_limb() : 0};
+        const U128 m{roll_limb() | roll_bool(), roll_limb()};
+        const ULOW e = roll_uint() % 130;
+        // Возведение в степень последовательным умножением.
+        U128 power{1};
+        U256 power256{1};
+        for (ULOW i = 0; i < e; ++i)
+        {
+            power = power * x;
+            power256 = power256 * U256{x, U128{0}};
+        }
+        is_ok &= same(pow(x, e), power) && same(pow(U256{x, U128{0}}, e), power256);
+        if (!m.is_zero())
+        {
+            const PlainModulus<U128> plain{m};
+            const U128 a = U128::mod(x, m);
+            U128 expected = plain.one();
+            for (ULOW i = 0; i < e; ++i)
+            {
+                expected = plain.mul(expected, a);
+            }
+            is_ok &= pow_mod(x, U128{e}, m) == expected && pow_mod(U256{x, U128{0}}, U256{e}, U256{m, U128{0}}) == U256{expected, U128{0}};
+            // Сумма показателей - произведение степеней.
+            const U128 e1{roll_limb(), roll_limb() >> 1};
+            const U128 e2{roll_limb(), roll_limb() >> 1};
+            is_ok &= pow_mod(x, e1 + e2, m) == plain.mul(pow_mod(x, e1, m), pow_mod(x, e2, m));
+        }
+        if (!is_ok)
+        {
+            std::cout << "x: " << x.value() << ", m: " << m.value() << ", e: " << e << std::endl;
+        }
+        assert(is_ok);
+        if (counter % internal_step == 0)
+        {
+            external_iterations++;
+            std::cout << "... iterations: " << counter << ". External: " << external_iterations << " from " << N << '\n';
+        }
+    }
+}
+
+void benchmark_division_u128_semi_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    const std::vector<ULOW> choice{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+                                   65535, 65534, 65533, 65532, 65531, 65530,
+                                   16384, 16383, 16382, 16385, 16386, 16387, 16388,
+                                   -1ull, -2ull, -3ull, -4ull, -5ull, -6ull, -7ull};
+    auto get_quadrupole = [&choice](bool is_bad) -> Quadrupole
+    {
+        Quadrupole q{choice[roll_uint() % choice.size()], choice[roll_uint() % choice.size()],
+                     is_bad ? 1 : choice[roll_uint() % choice.size()], choice[roll_uint() % choice.size()]};
+        return q;
+    };
+    auto make_operands = [&get_quadrupole](bool is_bad)
+    {
+        std::vector<std::pair<U128, U128>> operands;
+        while (operands.size() < internal_step)
+        {
+            const Quadrupole &q = get_quadrupole(is_bad);
+            if (q.is_zero_denominator())
+                continue;
+            operands.push_back(construct_two_128bit_numbers(q, Signess{roll_bool(), roll_bool()}));
+        }
+        return operands;
+    };
+    auto measure = [N](const std::vector<std::pair<U128, U128>> &operands, auto operation) -> double
+    {
+        ULOW checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < N; ++i)
+        {
+            for (const auto &[X, Y] : operands)
+            {
+                checksum += operation(X, Y);
+            }
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+        benchmark_sink = checksum;
+        return ns / (N * operands.size());
+    };
+    auto divide = [](const U128 &X, const U128 &Y) -> ULOW
+    {
+        const auto &[q, r] = X / Y;
+        return q.mLow + r.mLow;
+    };
+    auto div = [](const U128 &X, const U128 &Y) -> ULOW
+    {
+        return U128::div(X, Y).mLow;
+    };
+    auto mod = [](const U128 &X, const U128 &Y) -> ULOW
+    {
+        return U128::mod(X, Y).mLow;
+    };
+    auto divides = [](const U128 &X, const U128 &Y) -> ULOW
+    {
+        return U128::divides(X, Y);
+    };
+    const auto &semi_random = make_operands(false);
+    const auto &bad = make_operands(true);
+    std::vector<std::pair<U128, U128>> narrow; // 64-битные делители.
+    while (narrow.size() < internal_step)
+    {
+        const ULOW y = roll_ulow() >> (roll_uint() % 64);
+        if (y != 0)
+            narrow.emplace_back(U128{roll_ulow(), roll_ulow() >> (roll_uint() % 64), Sign{roll_bool()}}, U128{y});
+    }
+    std::vector<std::pair<U128, U128>> exact; // Делимое кратно делителю.
+    while (exact.size() < internal_step)
+    {
+        const U128 d{roll_ulow() >> (roll_uint() % 64), roll_ulow() >> (32 + roll_uint() % 32)};
+        const U128 x = d * (roll_ulow() >> (roll_uint() % 64));
+        if (!d.is_zero() && !x.is_singular())
+            exact.emplace_back(x, d);
+    }
+    std::cout << "U128 / U128, semi-random: " << measure(semi_random, divide) << " ns/division\n";
+    std::cout << "U128 / U128, (A*M + B)/(1*M + D): " << measure(bad, divide) << " ns/division\n";
+    std::cout << "U128 / U128, 64-bit divisor: " << measure(narrow, divide) << " ns/division\n";
+    std::cout << "div / mod / divides, semi-random: " << measure(semi_random, div) << " / "
+              << measure(semi_random, mod) << " / " << measure(semi_random, divides) << " ns/division\n";
+    std::cout << "div / mod / divides, 64-bit divisor: " << measure(narrow, div) << " / "
+              << measure(narrow, mod) << " / " << measure(narrow, divides) << " ns/division\n";
+    std::cout << "div / divexact, exact: " << measure(exact, div) << " / "
+              << measure(exact, [](const U128 &X, const U128 &Y) -> ULOW
+                         { return U128::divexact(X, Y).mLow; })
+              << " ns/division\n";
+}
+
+void benchmark_decimal_column_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    std::vector<U128> column(internal_step);
+    for (auto &x : column)
+    {
+        x = U128{roll_ulow(), roll_ulow() >> (roll_uint() % 64)};
+    }
+    std::vector<char> text(column.size() * 42);
+    const auto [end, _] = format_decimal_column(column, text.data(), text.data() + text.size());
+    const std::string_view column_text(text.data(), end - text.data());
+    auto measure_text = [N, &column_text](auto operation) -> double
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < N; ++i)
+        {
+            operation();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration<double>(stop - start).count();
+        return N * column_text.size() / seconds / 1e6;
+    };
+    std::vector<U128> parsed(column.size());
+    std::cout << "Decimal column parse, from_chars / parse_decimal_column: "
+              << measure_text([&]()
+                              {
+                                  const char *p = column_text.data();
+                                  for (auto &x : parsed)
+                                  {
+                                      p = from_chars(p, column_text.data() + column_text.size(), x).ptr + 1;
+                                  }
+                                  benchmark_sink = benchmark_sink + parsed.back().mLow; })
+              << " / "
+              << measure_text([&]()
+                              {
+                                  parse_decimal_column(column_text, parsed);
+                                  benchmark_sink = benchmark_sink + parsed.back().mLow; })
+              << " MB/s\n";
+    std::cout << "Decimal column format: "
+              << measure_text([&]()
+                              {
+                                  format_decimal_column(column, text.data(), text.data() + text.size());
+                                  benchmark_sink = benchmark_sink + text[0]; })
+              << " MB/s\n";
+}
+
+void benchmark_probable_prime_u512_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    std::vector<U512> candidates(1024); // Случайные нечетные 512-битные числа.
+    for (auto &x : candidates)
+    {
+        x = U512{U256{U128{roll_ulow() | 1, roll_ulow()}, U128{roll_ulow(), roll_ulow()}},
+                 U256{U128{roll_ulow(), roll_ulow()}, U128{roll_ulow(), roll_ulow() | (1ull << 63)}}};
+    }
+    long long primes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < N; ++i)
+    {
+        for (const auto &x : candidates)
+        {
+            primes += u128::utils::is_probable_prime(x);
+        }
+    }
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "BPSW, random odd 512-bit candidates: " << us / (N * candidates.size()) << " us/candidate, primes: "
+              << primes << " from " << N * candidates.size() << '\n';
+}
+
+void benchmark_mul_mod_randomly(long long N)
+{
+    if (N < 1)
+    {
+        std::cout << "Skipped!\n";
+        return;
+    }
+    // Модульное умножение: цепочка x = x * y mod m в представлении контекста.
+    auto measure_mul_mod = [N](const auto &ctx) -> double
+    {
+        using T = std::decay_t<decltype(ctx.modulus())>;
+        const T &m = ctx.modulus();
+        T x = ctx.to(m >> 1);
+        const T y = ctx.to(m >> 2);
+        const long long steps = N * 4096;
+        const auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < steps; ++i)
+        {
+            x = ctx.mul(x, y);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        benchmark_sink = u128::utils::low_limb(ctx.from(x));
+        return std::chrono::duration<double, std::nano>(stop - start).count() / steps;
+    };
+    auto report_mul_mod = [&measure_mul_mod](const auto &m, int width)
+    {
+        using T = std::decay_t<decltype(m)>;
+        std::cout << "Modular multiplication, " << width << "-bit modulus: division: " << measure_mul_mod(PlainModulus<T>{m})
+                  << " ns, Barrett: " << measure_mul_mod(Barrett<T>{m}) << " ns";
+        if constexpr (std::is_same_v<T, U128>)
+        {
+            std::cout << ", Montgomery: " << measure_mul_mod(MontgomeryU128{m}) << " ns";
+        }
+        std::cout << '\n';
+    };
+    using U1024 = GNumber<U512, 256>;
+    using U2048 = GNumber<U1024, 512>;
+    // Нечетные модули со старшим единичным битом.
+    const U128 m128{roll_ulow() | 1, roll_ulow() | (1ull << 63)};
+    const U256 m256{U128{roll_ulow() | 1, roll_ulow()}, m128};
+    const U512 m512{U256{m128, m128}, m256};
+    const U1024 m1024{U512{m256, m256}, m512};
+    report_mul_mod(U128{m128.mHigh | 1}, 64);
+    report_mul_mod(m128, 128);
+    report_mul_mod(m256, 256);
+    report_mul_mod(m512, 512);
+    report_mul_mod(m1024, 1024);
+    report_mul_mod(U2048{U1024{m512, m512}, m1024}, 2048);
+}
@@ -4,6 +4,12 @@
 #include <python3.10/Python.h>
 #include "u128.hpp"
 #include "gnumber.hpp"
+#include "i128.hpp"
+#include "divisor.hpp"
+#include "format.hpp"
+#include "decimal_column.hpp"
+#include "policy.hpp"
+#include "modular.hpp"
 
 using namespace u128;
 
@@ -162,4 +168,144 @@ void qs_factorization_tests();
 /**
  * Тесты решателя СЛАУ.
  */
-void solver_tests();
\ No newline at end of file
+void solver_tests();
+
+/**
+ * Случайный тест знаковых чисел в дополнительном коде: сравнивается с реализацией в прямом коде.
+ * @param N Количество внешних итераций.
+ */
+void test_twos_complement_randomly(long long N);
+
+/**
+ * Случайный тест деления с предвычисленным делителем: сравнивается с оператором деления.
+ * @param N Количество внешних итераций.
+ */
+void test_divisor_randomly(long long N);
+
+/**
+ * Случайный тест частного, остатка и проверки делимости без полного деления: сравнивается с оператором деления.
+ * @param N Количество внешних итераций.
+ */
+void test_div_mod_divides_randomly(long long N);
+
+/**
+ * Случайный тест точного деления умножением на обратный элемент: сравнивается с оператором деления.
+ * @param N Количество внешних итераций.
+ */
+void test_divexact_randomly(long long N);
+
+/**
+ * Случайный тест полного умножения 128- и 256-битных чисел: сравнивается с умножением "в столбик".
+ * @param N Количество внешних итераций.
+ */
+void test_mul_wide_randomly(long long N);
+
+/**
+ * Случайный тест возведения в квадрат sqr и sqr_wide 128- и 256-битных чисел:
+ * сравнивается с умножением "в столбик" и с умножением на копию числа.
+ * @param N Количество внешних итераций.
+ */
+void test_sqr_randomly(long long N);
+
+/**
+ * Случайный тест записи чисел в строку и чтения обратно в различных системах счисления.
+ * @param N Количество внешних итераций.
+ */
+void test_chars_roundtrip_randomly(long long N);
+
+/**
+ * Случайный тест записи to_chars 128-, 256- и 512-битных чисел в системах счисления 2, 8, 10 и 16:
+ * сравнивается с записью Python; числа передаются в Python 64-битными цифрами.
+ * @param N Количество внешних итераций.
+ */
+void test_to_chars_randomly(long long N);
+
+/**
+ * Случайный тест пакетной записи и разбора столбцов десятичных чисел.
+ * @param N Количество внешних итераций.
+ */
+void test_decimal_column_randomly(long long N);
+
+/**
+ * Случайный тест политик переполнения Wrapping, Saturating и Unchecked для 128- и 256-битных чисел:
+ * сравнивается с арифметикой по модулю и с обычными операторами.
+ * @param N Количество внешних итераций.
+ */
+void test_policies_randomly(long long N);
+
+/**
+ * Случайный тест операций с 64-битными операндами, инкремента и декремента: сравнивается с операциями над U128 и U256.
+ * @param N Количество внешних итераций.
+ */
+void test_mixed_operands_randomly(long long N);
+
+/**
+ * Случайный тест функций подсчета битов для 128-, 256- и 512-битных чисел: сравнивается с побитовым просмотром.
+ * @param N Количество внешних итераций.
+ */
+void test_bit_scan_randomly(long long N);
+
+/**
+ * Случайный тест целочисленного квадратного корня и проверки на точный квадрат для 128-, 256- и 512-битных чисел.
+ * @param N Количество внешних итераций.
+ */
+void test_isqrt_wide_randomly(long long N);
+
+/**
+ * Случайный тест проверки на простоту и остатка от деления 256-битного числа на 128-битное:
+ * сравнивается с пробным делением, известными псевдопростыми и оператором деления U256.
+ * @param N Количество внешних итераций.
+ */
+void test_is_prime_randomly(long long N);
+
+/**
+ * Случайный тест Baillie-PSW для 256-2048-битных чисел и остатка от деления 512-битного числа на 256-битное:
+ * сравнивается с проверкой на простоту U128, известными простыми и оператором деления U512.
+ * @param N Количество внешних итераций.
+ */
+void test_probable_prime_randomly(long long N);
+
+/**
+ * Случайный тест арифметики Монтгомери по нечетному 128-битному модулю: сравнение с приведением делением.
+ * @param N Количество внешних итераций.
+ */
+void test_montgomery_u128_randomly(long long N);
+
+/**
+ * Случайный тест приведения по Барретту для U128, U256 и U512, включая четные и 64-битные модули:
+ * сравнение с приведением делением.
+ * @param N Количество внешних итераций.
+ */
+void test_barrett_randomly(long long N);
+
+/**
+ * Случайный тест степеней pow и pow_mod для U128 и U256: сравнение с последовательным умножением,
+ * свойство суммы показателей и малая теорема Ферма для известных простых до 2048 бит.
+ * @param N Количество внешних итераций.
+ */
+void test_pow_mod_randomly(long long N);
+
+/**
+ * Замер скорости деления 128-битных чисел на полуслучайном наборе значений вблизи угловых и граничных.
+ * Отдельно замеряются "плохие" для оценки частного случаи: (A*M + B)/(1*M + D).
+ * @param N Количество внешних итераций.
+ */
+void benchmark_division_u128_semi_randomly(long long N);
+
+/**
+ * Замер скорости пакетного разбора и записи столбца случайных десятичных чисел, в МБ/с.
+ * @param N Количество проходов по столбцу.
+ */
+void benchmark_decimal_column_randomly(long long N);
+
+/**
+ * Замер скорости теста Baillie-PSW на случайных нечетных 512-битных числах.
+ * @param N Количество проходов по набору чисел.
+ */
+void benchmark_probable_prime_u512_randomly(long long N);
+
+/**
+ * Замер скорости модульного умножения делением, по Барретту и по Монтгомери для модулей от 64 до 2048 бит.
+ * @param N Количество внешних итераций.
+ */
+void benchmark_mul_mod_randomly(long long N);
@@ -1,18 +1,36 @@
 #pragma once
 
-#include <algorithm> // std::reverse
+#include <algorithm> // std::min, std::copy_n
+#include <array>     // std::array
 #include <tuple>     // std::ignore, std::tie
 #include <utility>   // std::pair
 #include <cassert>   // assert
 #include <string>    // std::string
+#include <bit>       // std::countl_zero, std::popcount
+#include <charconv>  // std::to_chars_result
+#include <cstddef>   // std::ptrdiff_t
+#include <type_traits> // std::is_constant_evaluated
+#include <string_view>
+#include <concepts>  // std::signed_integral
 
 #include "singular.hpp"
 #include "sign.hpp"
 
+// Выбор вычислительного ядра. Если компилятор поддерживает встроенный 128-битный тип (GCC, Clang),
+// то базовые операции выполняются через него: компилятор сам формирует mul/mulx, add/adc и т.п.
+// Переносимое ядро на 32-битных половинках включается принудительно определением U128_PORTABLE.
+#if defined(__SIZEOF_INT128__) && !defined(U128_PORTABLE)
+#define U128_NATIVE
+#endif
+
 namespace u128
 {
     using ULOW = uint64_t; // Тип половинок: старшей и младшей частей составного числа.
 
+#ifdef U128_NATIVE
+    __extension__ typedef unsigned __int128 UNATIVE; // Встроенный 128-битный беззнаковый тип.
+#endif
+
     static constexpr auto INF = "inf";
 
     struct Quadrupole
@@ -22,7 +40,7 @@ namespace u128
         ULOW B;
         ULOW C;
         ULOW D;
-        bool is_zero_denominator() const
+        constexpr bool is_zero_denominator() const
         {
             return C == 0 && D == 0;
         }
@@ -41,9 +59,475 @@ namespace u128
         ULOW B;
     };
 
+    // "Сырое" беззнаковое 128-битное число: ровно 16 байт, без знака и флагов.
+    // Допускает побайтовое копирование (memcpy) и пакетную обработку массивов.
+    struct U128Raw
+    {
+        ULOW mLow;
+        ULOW mHigh;
+    };
+
+    static_assert(sizeof(U128Raw) == 16);
+
     static constexpr char DIGITS[10]{'0', '1', '2', '3', '4',
                                      '5', '6', '7', '8', '9'};
 
+    // Пары десятичных цифр "00", "01", ..., "99": две цифры за одно обращение к таблице.
+    static constexpr auto DIGIT_PAIRS = []()
+    {
+        std::array<char, 200> result{};
+        for (int i = 0; i < 100; ++i)
+        {
+            result[2 * i] = DIGITS[i / 10];
+            result[2 * i + 1] = DIGITS[i % 10];
+        }
+        return result;
+    }();
+
+    // Цифры систем счисления с основанием до 36.
+    static constexpr char DIGITS_36[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+    // Значения цифр по коду символа (в любом регистре); 36 - не цифра.
+    static constexpr auto DIGIT_VALUES = []()
+    {
+        std::array<unsigned char, 256> result{};
+        result.fill(36);
+        for (int i = 0; i < 36; ++i)
+        {
+            result[static_cast<unsigned char>(DIGITS_36[i])] = i;
+            result[static_cast<unsigned char>(DIGITS_36[i] - (i >= 10 ? 'a' - 'A' : 0))] = i;
+        }
+        return result;
+    }();
+
+    // Наибольшая степень десяти, умещающаяся в 64 бита: основание "порций" при переводе в десятичную запись.
+    static constexpr ULOW CHUNK_BASE = 10'000'000'000'000'000'000ull;
+    static constexpr int CHUNK_DIGITS = 19;
+
+    /**
+     * @brief Записывает ровно 8 десятичных цифр числа v < 10^8 начиная с p.
+     * @details Четыре пары цифр вычисляются независимо друг от друга, без цепочки делений.
+     */
+    constexpr void write_eight_digits(uint32_t v, char *p)
+    {
+        const uint32_t high = v / 10000;
+        const uint32_t low = v % 10000;
+        const char *const pairs = DIGIT_PAIRS.data();
+        std::copy_n(pairs + 2 * (high / 100), 2, p);
+        std::copy_n(pairs + 2 * (high % 100), 2, p + 2);
+        std::copy_n(pairs + 2 * (low / 100), 2, p + 4);
+        std::copy_n(pairs + 2 * (low % 100), 2, p + 6);
+    }
+
+    /**
+     * @brief Записывает цифры 64-битного числа в системе счисления base справа налево, заканчивая перед end.
+     * @param min_digits Минимальное количество цифр: недостающие дополняются ведущими нулями.
+     * @return Указатель на первую записанную цифру.
+     */
+    constexpr char *write_digits_backward(ULOW x, char *end, int min_digits = 1, int base = 10)
+    {
+        char *p = end;
+        if (base == 10)
+        {
+            while (x >= 100'000'000)
+            {
+                const ULOW q = x / 100'000'000;
+                p -= 8;
+                write_eight_digits(static_cast<uint32_t>(x - q * 100'000'000), p);
+                x = q;
+            }
+            while (x >= 100)
+            {
+                const auto pair = 2 * (x % 100);
+                x /= 100;
+                *--p = DIGIT_PAIRS[pair + 1];
+                *--p = DIGIT_PAIRS[pair];
+            }
+            if (x >= 10)
+            {
+                *--p = DIGIT_PAIRS[2 * x + 1];
+                *--p = DIGIT_PAIRS[2 * x];
+            }
+            else
+            {
+                *--p = DIGITS[x];
+            }
+        }
+        else
+        {
+            do
+            {
+                *--p = DIGITS_36[x % base];
+                x /= base;
+            } while (x != 0);
+        }
+        while (end - p < min_digits)
+        {
+            *--p = '0';
+        }
+        return p;
+    }
+
+    /**
+     * @brief Количество цифр 64-битного числа в системе счисления base, минимум 1.
+     */
+    constexpr int count_digits(ULOW x, int base = 10)
+    {
+        int result = 1;
+        for (const ULOW b = base; x >= b; x /= b)
+        {
+            ++result;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Параметры "порции" цифр для системы счисления base: наибольшая степень base, умещающаяся в 64 бита.
+     * @param chunk_base Основание порции, base^k.
+     * @return Количество цифр в порции, k.
+     */
+    constexpr int chunk_params(int base, ULOW &chunk_base)
+    {
+        if (base == 10)
+        {
+            chunk_base = CHUNK_BASE;
+            return CHUNK_DIGITS;
+        }
+        chunk_base = base;
+        int chunk_digits = 1;
+        while (chunk_base <= ULOW(-1) / base)
+        {
+            chunk_base *= base;
+            chunk_digits++;
+        }
+        return chunk_digits;
+    }
+
+    /**
+     * @brief Значение цифры в системах счисления с основанием до 36; для прочих символов - 36.
+     */
+    constexpr int digit_value(char c)
+    {
+        return DIGIT_VALUES[static_cast<unsigned char>(c)];
+    }
+
+    /**
+     * @brief Количество битов на цифру, если base - степень двойки, иначе 0.
+     */
+    constexpr int pow2_digit_bits(int base)
+    {
+        return std::has_single_bit(static_cast<unsigned>(base)) ? std::countr_zero(static_cast<unsigned>(base)) : 0;
+    }
+
+    /**
+     * @brief Записывает несингулярное число в системе счисления 2^bits без деления: цифры выбираются
+     * из 64-битных слов числа сдвигом и маской.
+     */
+    template <typename T>
+    constexpr std::to_chars_result to_chars_pow2(char *first, char *last, const T &x, int bits)
+    {
+        std::array<ULOW, T::mLimbs> limbs;
+        T::store_limbs(x, limbs.data());
+        int n = T::mLimbs;
+        while (n > 1 && limbs[n - 1] == 0)
+        {
+            --n;
+        }
+        const int width = (n - 1) * 64 + std::bit_width(limbs[n - 1]);
+        const int digits = std::max(1, (width + bits - 1) / bits);
+        const bool negative = x.is_negative();
+        const std::ptrdiff_t length = negative + digits;
+        if (last - first < length)
+        {
+            return {last, std::errc::value_too_large};
+        }
+        const ULOW mask = (ULOW{1} << bits) - 1;
+        char *p = first + length;
+        if (64 % bits == 0)
+        { // Цифры не пересекают границ слов: каждое слово разбирается отдельно.
+            const int limb_digits = 64 / bits;
+            for (int i = 0, rest = digits; rest > 0; ++i, rest -= limb_digits)
+            {
+                ULOW limb = limbs[i];
+                for (int k = std::min(rest, limb_digits); k > 0; --k, limb >>= bits)
+                {
+                    *--p = DIGITS_36[limb & mask];
+                }
+            }
+        }
+        else
+        {
+            for (int pos = 0; pos < digits * bits; pos += bits)
+            {
+                const int i = pos / 64;
+                const int shift = pos % 64;
+                ULOW digit = limbs[i] >> shift;
+                if (shift + bits > 64 && i + 1 < n)
+                {
+                    digit |= limbs[i + 1] << (64 - shift);
+                }
+                *--p = DIGITS_36[digit & mask];
+            }
+        }
+        if (negative)
+        {
+            *--p = '-';
+        }
+        return {first + length, std::errc{}};
+    }
+
+    /**
+     * @brief Читает беззнаковую часть числа из цифр [first, last) системы счисления 2^bits без умножений:
+     * цифры раскладываются по 64-битным словам сдвигами, начиная с младшей.
+     * @return false, если число не умещается в T.
+     */
+    template <typename T>
+    constexpr bool from_chars_pow2(const char *first, const char *last, T &x, int bits)
+    {
+        std::array<ULOW, T::mLimbs> limbs{};
+        bool fits = true;
+        if (64 % bits == 0)
+        { // Цифры не пересекают границ слов: каждое слово собирается из своей группы цифр.
+            const std::ptrdiff_t limb_digits = 64 / bits;
+            const char *p = last;
+            for (int i = 0; p != first && fits; ++i)
+            {
+                const char *const group = p - std::min(limb_digits, p - first);
+                ULOW limb = 0;
+                for (const char *q = group; q != p; ++q)
+                {
+                    limb = (limb << bits) | digit_value(*q);
+                }
+                p = group;
+                if (i < T::mLimbs)
+                {
+                    limbs[i] = limb;
+                }
+                else
+                {
+                    fits = limb == 0;
+                }
+            }
+        }
+        else
+        {
+            std::size_t pos = 0;
+            for (const char *p = last; p != first; pos += bits)
+            {
+                const ULOW digit = digit_value(*--p);
+                if (digit == 0)
+                {
+                    continue;
+                }
+                const std::size_t i = pos / 64;
+                const int shift = pos % 64;
+                if (i >= static_cast<std::size_t>(T::mLimbs))
+                {
+                    fits = false;
+                    break;
+                }
+                limbs[i] |= digit << shift;
+                if (shift + bits > 64)
+                {
+                    const ULOW rest = digit >> (64 - shift);
+                    if (i + 1 < static_cast<std::size_t>(T::mLimbs))
+                    {
+                        limbs[i + 1] |= rest;
+                    }
+                    else
+                    {
+                        fits &= rest == 0;
+                    }
+                }
+            }
+        }
+        T::load_limbs(x, limbs.data());
+        return fits;
+    }
+
+    /**
+     * @brief Записывает число в [first, last) в системе счисления base (2...36) без выделения памяти.
+     * @details T - U128 или GNumber. Цифры формируются порциями: делением "в столбик" на наибольшую
+     * степень base, умещающуюся в 64 бита; для оснований - степеней двойки цифры выбираются из слов
+     * числа напрямую, за линейное время. Переполнение записывается как "inf", NaN - как пустая строка.
+     * @return {конец записи, errc{}} или {last, errc::value_too_large}, если не хватает места.
+     */
+    template <typename T>
+    constexpr std::to_chars_result to_chars(char *first, char *last, const T &x, int base = 10)
+    {
+        assert(base >= 2 && base <= 36);
+        if (x.is_singular())
+        {
+            const std::string_view special = x.is_overflow() ? INF : "";
+            if (last - first < static_cast<std::ptrdiff_t>(special.size()))
+            {
+                return {last, std::errc::value_too_large};
+            }
+            return {std::copy(special.begin(), special.end(), first), std::errc{}};
+        }
+        if (const int bits = pow2_digit_bits(base))
+        {
+            return to_chars_pow2(first, last, x, bits);
+        }
+        ULOW chunk_base;
+        const int chunk_digits = chunk_params(base, chunk_base);
+        // В порции не меньше 58 битов: 36^12 > 2^58.
+        std::array<ULOW, sizeof(T) / 4 + 1> chunks;
+        std::size_t n = 0;
+        T X = x;
+        do
+        {
+            chunks[n++] = T::short_divmod(X, chunk_base);
+        } while (!X.is_zero());
+        const bool negative = x.is_negative();
+        const std::ptrdiff_t length = negative + count_digits(chunks[n - 1], base) + (n - 1) * chunk_digits;
+        if (last - first < length)
+        {
+            return {last, std::errc::value_too_large};
+        }
+        char *p = first + length;
+        for (std::size_t i = 0; i + 1 < n; ++i)
+        {
+            p = write_digits_backward(chunks[i], p, chunk_digits, base);
+        }
+        p = write_digits_backward(chunks[n - 1], p, 1, base);
+        if (negative)
+        {
+            *--p = '-';
+        }
+        return {first + length, std::errc{}};
+    }
+
+    /**
+     * @brief Читает число из [first, last) в системе счисления base (2...36).
+     * @details T - U128 или GNumber. Допускается ведущий минус; "inf" читается как переполнение,
+     * если 'i' не является цифрой в данной системе счисления (base <= 18).
+     * Цифры накапливаются порциями по 64 бита и добавляются к числу умножением на степень base со сложением;
+     * для оснований - степеней двойки цифры раскладываются по словам числа сдвигами, за линейное время.
+     * @return {конец разобранных символов, errc{}}. Если цифр нет - {first, errc::invalid_argument}, value не меняется.
+     * Если число не умещается в T - {конец цифр, errc::result_out_of_range}, value получает флаг переполнения.
+     */
+    template <typename T>
+    constexpr std::from_chars_result from_chars(const char *first, const char *last, T &value, int base = 10)
+    {
+        assert(base >= 2 && base <= 36);
+        const char *p = first;
+        const bool negative = p != last && *p == '-';
+        p += negative;
+        const std::string_view special = INF;
+        if (digit_value(special.front()) >= base &&
+            static_cast<std::size_t>(last - p) >= special.size() && std::string_view(p, special.size()) == special)
+        {
+            value = T{};
+            value.set_overflow();
+            return {p + special.size(), std::errc{}};
+        }
+        const char *const digits = p;
+        T result{0};
+        bool overflow = false;
+        if (const int bits = pow2_digit_bits(base))
+        {
+            while (p != last && digit_value(*p) < base)
+            {
+                ++p;
+            }
+            overflow = !from_chars_pow2(digits, p, result, bits);
+        }
+        else
+        {
+            ULOW chunk_base;
+            const int chunk_digits = chunk_params(base, chunk_base);
+            for (;;)
+            {
+                ULOW chunk = 0;
+                ULOW scale = 1;
+                int n = 0;
+                for (int d; n < chunk_digits && p != last && (d = digit_value(*p)) < base; ++n, ++p)
+                {
+                    chunk = chunk * base + d;
+                    scale *= base;
+                }
+                if (n == 0)
+                {
+                    break;
+                }
+                overflow |= T::mul_add_short(result, scale, chunk) != 0;
+                if (n < chunk_digits)
+                {
+                    break;
+                }
+            }
+        }
+        if (p == digits)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+        if (overflow)
+        {
+            value = T{};
+            value.set_overflow();
+            return {p, std::errc::result_out_of_range};
+        }
+        result.mSign = negative && !result.is_zero();
+        value = result;
+        return {p, std::errc{}};
+    }
+
+    /**
+     * @brief Читает число из всей строки s в системе счисления base.
+     * @details Пустая строка или посторонние символы дают NaN, слишком большое число - переполнение.
+     */
+    template <typename T>
+    constexpr T from_string(std::string_view s, int base = 10)
+    {
+        T result{0};
+        const auto [ptr, ec] = from_chars(s.data(), s.data() + s.size(), result, base);
+        if (ec == std::errc::invalid_argument || ptr != s.data() + s.size())
+        {
+            result = T{0};
+            result.set_nan();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Шестнадцатеричная запись числа, без префикса "0x".
+     */
+    template <typename T>
+    constexpr std::string to_hex(const T &x)
+    {
+        char buffer[T::mLimbs * 16 + 2];
+        const auto [end, _] = to_chars(buffer, buffer + sizeof(buffer), x, 16);
+        return std::string(buffer, end);
+    }
+
+    /**
+     * @brief Двоичная запись числа, без префикса "0b".
+     */
+    template <typename T>
+    constexpr std::string to_binary(const T &x)
+    {
+        char buffer[T::mLimbs * 64 + 2];
+        const auto [end, _] = to_chars(buffer, buffer + sizeof(buffer), x, 2);
+        return std::string(buffer, end);
+    }
+
+    template <typename T>
+    constexpr T from_hex(std::string_view s)
+    {
+        return from_string<T>(s, 16);
+    }
+
+    template <typename T>
+    constexpr T from_binary(std::string_view s)
+    {
+        return from_string<T>(s, 2);
+    }
+
+    struct U128;
+
+    constexpr int countr_zero(const U128 &x);
+
     // High/Low структура 128-битного числа со знаком и флагом переполнения.
     // Для иллюстрации алгоритма деления двух U128 чисел реализованы основные
     // арифметические операторы, кроме умножения двух U128 чисел.
@@ -53,6 +537,8 @@ namespace u128
         static constexpr int mHalfWidth = 64 / 2;
         // Наибольшее значение половинок, M-1.
         static constexpr ULOW mMaxULOW = ULOW{-1ull};
+        // Количество 64-битных слов в числе.
+        static constexpr int mLimbs = 2;
         ULOW mLow = 0;
         ULOW mHigh = 0;
         Sign mSign{};
@@ -72,13 +558,13 @@ namespace u128
 
         constexpr U128 &operator=(const U128 &other) = default;
 
-        bool operator==(const U128 &other) const
+        constexpr bool operator==(const U128 &other) const
         {
             const auto has_singular = mSingular != other.mSingular;
             return has_singular ? false : *this <=> other == 0;
         }
 
-        std::partial_ordering operator<=>(const U128 &other) const
+        constexpr std::partial_ordering operator<=>(const U128 &other) const
         {
             const auto has_singular = mSingular != other.mSingular;
             if (has_singular)
@@ -134,53 +620,109 @@ namespace u128
             }
         }
 
-        bool is_singular() const
+        /**
+         * @brief Сравнение с 64-битным числом без построения временного U128.
+         */
+        constexpr bool operator==(ULOW y) const
+        {
+            return !is_singular() && mHigh == 0 && mLow == y && (!mSign() || y == 0);
+        }
+
+        template <std::signed_integral S>
+        constexpr bool operator==(S y) const
+        {
+            return y < 0 ? *this == U128{magnitude(y), 0, Sign{true}} : *this == static_cast<ULOW>(y);
+        }
+
+        constexpr std::partial_ordering operator<=>(ULOW y) const
+        {
+            if (is_singular())
+            {
+                return std::partial_ordering::unordered;
+            }
+            if (is_negative())
+            {
+                return std::partial_ordering::less;
+            }
+            return mHigh != 0 ? std::partial_ordering::greater : mLow <=> y;
+        }
+
+        template <std::signed_integral S>
+        constexpr std::partial_ordering operator<=>(S y) const
+        {
+            return y < 0 ? *this <=> U128{magnitude(y), 0, Sign{true}} : *this <=> static_cast<ULOW>(y);
+        }
+
+        constexpr bool is_singular() const
         {
             return mSingular();
         }
 
-        bool is_overflow() const
+        constexpr bool is_overflow() const
         {
             return mSingular.IsOverflow() && !mSingular.IsNaN();
         }
 
-        bool is_nan() const
+        constexpr bool is_nan() const
         {
             return mSingular.IsNaN() && !mSingular.IsOverflow();
         }
 
-        bool is_zero() const
+        constexpr bool is_zero() const
         {
             return mLow == 0 && mHigh == 0 && !is_singular();
         }
 
-        bool is_unit() const
+        constexpr bool is_unit() const
         {
             return mLow == 1 && mHigh == 0 && !mSign() && !is_singular();
         }
 
-        bool is_negative() const
+        constexpr bool is_negative() const
         {
             return !is_zero() && mSign() && !is_singular();
         }
 
-        bool is_positive() const
+        constexpr bool is_positive() const
         {
             return !is_zero() && !mSign() && !is_singular();
         }
 
-        bool is_nonegative() const
+        constexpr bool is_nonegative() const
         {
             return is_positive() || is_zero();
         }
 
-        void set_overflow()
+        /**
+         * @brief Представимо ли число в "сыром" виде: неотрицательное и без флагов.
+         */
+        constexpr bool is_raw() const
+        {
+            return !is_negative() && !is_singular();
+        }
+
+        /**
+         * @brief Возвращает "сырое" 16-байтное представление числа.
+         * @details Допустимо только для "сырых" чисел, см. is_raw().
+         */
+        constexpr U128Raw raw() const
+        {
+            assert(is_raw());
+            return U128Raw{mLow, mHigh};
+        }
+
+        static constexpr U128 from_raw(const U128Raw &x)
+        {
+            return U128{x.mLow, x.mHigh};
+        }
+
+        constexpr void set_overflow()
         {
             mSingular.mOverflow = 1;
             mSingular.mNaN = 0;
         }
 
-        void set_nan()
+        constexpr void set_nan()
         {
             mSingular.mOverflow = 0;
             mSingular.mNaN = 1;
@@ -190,7 +732,7 @@ namespace u128
          * @brief Оператор сдвига влево. Аналогичен умножению на степень 2.
          * @details Сохраняет знак. Для заведомо больших сдвигов дает переполнение.
          */
-        U128 operator<<(uint32_t shift) const
+        constexpr U128 operator<<(uint32_t shift) const
         {
             U128 result = *this;
             if (shift >= 128u) {
@@ -218,7 +760,7 @@ namespace u128
             return result;
         }
 
-        U128 &operator<<=(const uint32_t shift)
+        constexpr U128 &operator<<=(const uint32_t shift)
         {
             *this = *this << shift;
             return *this;
@@ -228,7 +770,7 @@ namespace u128
          * @brief Оператор сдвига вправо. Аналогичен делению на степень 2.
          * @details Сохраняет знак. Для заведомо больших сдвигов дает ноль.
          */
-        U128 operator>>(uint32_t shift) const
+        constexpr U128 operator>>(uint32_t shift) const
         {
             if (shift >= 128u) {
                 return U128{0};
@@ -255,13 +797,13 @@ namespace u128
             return result;
         }
 
-        U128 &operator>>=(const uint32_t shift)
+        constexpr U128 &operator>>=(const uint32_t shift)
         {
             *this = *this >> shift;
             return *this;
         }
 
-        U128 operator&(const U128 &mask) const
+        constexpr U128 operator&(const U128 &mask) const
         {
             U128 result = *this;
             result.mLow &= mask.mLow;
@@ -269,13 +811,13 @@ namespace u128
             return result;
         }
 
-        U128 &operator&=(const U128 &mask)
+        constexpr U128 &operator&=(const U128 &mask)
         {
             *this = *this & mask;
             return *this;
         }
 
-        U128 operator|(const U128 &mask) const
+        constexpr U128 operator|(const U128 &mask) const
         {
             U128 result = *this;
             result.mLow |= mask.mLow;
@@ -283,13 +825,13 @@ namespace u128
             return result;
         }
 
-        U128 &operator|=(const U128 &mask)
+        constexpr U128 &operator|=(const U128 &mask)
         {
             *this = *this | mask;
             return *this;
         }
 
-        U128 operator-() const
+        constexpr U128 operator-() const
         {
             U128 result = *this;
             -result.mSign;
@@ -307,14 +849,14 @@ namespace u128
             return result;
         }
 
-        U128 abs() const
+        constexpr U128 abs() const
         {
             U128 result = *this;
             result.mSign = false;
             return result;
         }
 
-        U128 operator+(U128 rhs) const
+        constexpr U128 operator+(U128 rhs) const
         {
             U128 result{};
             U128 X = *this;
@@ -339,6 +881,11 @@ namespace u128
                 result = X - rhs;
                 return result;
             }
+#ifdef U128_NATIVE
+            const UNATIVE sum = X.native() + rhs.native();
+            result = from_native(sum);
+            result.mSingular.mOverflow = sum < X.native();
+#else
             result.mLow = X.mLow + rhs.mLow;
             const ULOW c1 = result.mLow < std::min(X.mLow, rhs.mLow);
             result.mHigh = X.mHigh + rhs.mHigh;
@@ -347,6 +894,7 @@ namespace u128
             result.mHigh = tmp + c1;
             const int c3 = result.mHigh < std::min(tmp, c1);
             result.mSingular.mOverflow = c2 || c3;
+#endif
             if (X.mSign() && rhs.mSign())
             {
                 result.mSign = true;
@@ -354,13 +902,13 @@ namespace u128
             return result;
         }
 
-        U128 &operator+=(U128 other)
+        constexpr U128 &operator+=(U128 other)
         {
             *this = *this + other;
             return *this;
         }
 
-        U128 operator-(U128 rhs) const
+        constexpr U128 operator-(U128 rhs) const
         {
             U128 result{};
             U128 X = *this;
@@ -395,9 +943,21 @@ namespace u128
             if (X.is_zero())
             {
                 result = rhs;
-                -result.mSign;
+                result.mSign = !rhs.is_zero(); // 0 - 0 = +0.
                 return result;
             }
+#ifdef U128_NATIVE
+            if (X.native() >= rhs.native())
+            {
+                result = from_native(X.native() - rhs.native());
+            }
+            else
+            {
+                result = from_native(rhs.native() - X.native());
+                result.mSign = true;
+            }
+            return result;
+#else
             result.mLow = X.mLow - rhs.mLow;
             result.mHigh = X.mHigh - rhs.mHigh;
             const bool borrow = X.mLow < rhs.mLow;
@@ -419,36 +979,142 @@ namespace u128
                 result.mSign = true;
             }
             return result;
+#endif
         }
 
-        U128 &operator-=(U128 other)
+        constexpr U128 &operator-=(U128 other)
         {
             *this = *this - other;
             return *this;
         }
 
         /**
-         * @brief Инкремент числа.
+         * @brief Инкремент числа: одно сложение и одна проверка переноса.
          * @return Число + 1.
          */
-        U128 &inc()
+        constexpr U128 &inc()
         {
-            *this = *this + U128{1};
+            if (is_singular())
+            {
+                return *this;
+            }
+            if (is_negative())
+            { // Модуль не меньше единицы: заем из старшей половины не выходит за пределы числа.
+                mHigh -= mLow == 0;
+                mLow--;
+                mSign = mLow != 0 || mHigh != 0;
+                return *this;
+            }
+            mSign = false;
+            mLow++;
+            if (mLow == 0) [[unlikely]]
+            {
+                mHigh++;
+                mSingular.mOverflow = mHigh == 0;
+            }
             return *this;
         }
 
         /**
-         * @brief Декремент числа.
+         * @brief Декремент числа: одно вычитание и одна проверка заема.
          * @return Число - 1.
          */
-        U128 &dec()
+        constexpr U128 &dec()
         {
-            *this = *this - U128{1};
+            if (is_singular())
+            {
+                return *this;
+            }
+            if (mLow == 0 && mHigh == 0)
+            {
+                mLow = 1;
+                mSign = true;
+                return *this;
+            }
+            if (mSign())
+            {
+                mLow++;
+                if (mLow == 0) [[unlikely]]
+                {
+                    mHigh++;
+                    mSingular.mOverflow = mHigh == 0;
+                }
+                return *this;
+            }
+            mHigh -= mLow == 0;
+            mLow--;
             return *this;
         }
 
-        static U128 mult64(ULOW x, ULOW y)
+        /**
+         * @brief Модуль 64-битного знакового числа, включая INT64_MIN.
+         */
+        template <std::signed_integral S>
+        static constexpr ULOW magnitude(S y)
+        {
+            return y < 0 ? ULOW{0} - static_cast<ULOW>(y) : static_cast<ULOW>(y);
+        }
+
+        /**
+         * @brief Сложение с 64-битным числом без построения временного U128.
+         * @details Для неотрицательного числа - одно сложение и одна проверка переноса.
+         */
+        constexpr U128 operator+(ULOW y) const
+        {
+            if (is_negative())
+            {
+                return *this + U128{y};
+            }
+            if (is_singular())
+            {
+                return *this;
+            }
+            U128 result{mLow + y, mHigh};
+            if (result.mLow < y) [[unlikely]]
+            {
+                result.mHigh++;
+                result.mSingular.mOverflow = result.mHigh == 0;
+            }
+            return result;
+        }
+
+        template <std::signed_integral S>
+        constexpr U128 operator+(S y) const
+        {
+            return y < 0 ? *this - magnitude(y) : *this + static_cast<ULOW>(y);
+        }
+
+        /**
+         * @brief Вычитание 64-битного числа без построения временного U128.
+         * @details Если разность неотрицательна - одно вычитание и одна проверка заема.
+         */
+        constexpr U128 operator-(ULOW y) const
+        {
+            if (is_negative() || (mHigh == 0 && mLow < y))
+            {
+                return *this - U128{y};
+            }
+            if (is_singular())
+            {
+                return *this;
+            }
+            return U128{mLow - y, mHigh - (mLow < y)};
+        }
+
+        template <std::signed_integral S>
+        constexpr U128 operator-(S y) const
+        {
+            return y < 0 ? *this + magnitude(y) : *this - static_cast<ULOW>(y);
+        }
+
+        /**
+         * @brief Полное произведение двух 64-битных чисел.
+         */
+        static constexpr U128 mult64(ULOW x, ULOW y)
         {
+#ifdef U128_NATIVE
+            return from_native(static_cast<UNATIVE>(x) * y);
+#else
             constexpr ULOW MASK = (ULOW(1) << mHalfWidth) - 1u;
             const ULOW x_low = x & MASK;
             const ULOW y_low = y & MASK;
@@ -473,12 +1139,67 @@ namespace u128
             result.mHigh += t3;
             result.mSingular.mOverflow = result.mHigh < t3;
             return result;
+#endif
+        }
+
+        /**
+         * @brief Полное произведение беззнаковых частей двух 128-битных чисел.
+         * @details Четыре произведения 64x64 и сложение средних слагаемых с переносами.
+         * @return Пара {младшие 128 бит, старшие 128 бит}.
+         */
+        static constexpr std::pair<U128, U128> mul_wide(const U128 &x, const U128 &y)
+        {
+            const U128 ll = mult64(x.mLow, y.mLow);
+            const U128 lh = mult64(x.mLow, y.mHigh);
+            const U128 hl = mult64(x.mHigh, y.mLow);
+            const U128 hh = mult64(x.mHigh, y.mHigh);
+            ULOW middle = ll.mHigh + lh.mLow;
+            ULOW carry = middle < lh.mLow;
+            middle += hl.mLow;
+            carry += middle < hl.mLow;
+            ULOW high_low = hh.mLow + lh.mHigh;
+            ULOW high_carry = high_low < lh.mHigh;
+            high_low += hl.mHigh;
+            high_carry += high_low < hl.mHigh;
+            high_low += carry;
+            high_carry += high_low < carry;
+            return std::make_pair(U128{ll.mLow, middle}, U128{high_low, hh.mHigh + high_carry});
+        }
+
+        /**
+         * @brief Старшие 128 бит полного произведения беззнаковых частей двух 128-битных чисел.
+         */
+        static constexpr U128 mulhi(const U128 &x, const U128 &y)
+        {
+            return mul_wide(x, y).second;
+        }
+
+        /**
+         * @brief Полный квадрат беззнаковой части 128-битного числа.
+         * @details Три произведения 64x64 вместо четырех: среднее слагаемое вычисляется один раз и удваивается.
+         * @return Пара {младшие 128 бит, старшие 128 бит}.
+         */
+        static constexpr std::pair<U128, U128> sqr_wide(const U128 &x)
+        {
+            const U128 ll = mult64(x.mLow, x.mLow);
+            const U128 lh = mult64(x.mLow, x.mHigh);
+            const U128 hh = mult64(x.mHigh, x.mHigh);
+            const ULOW cross_low = lh.mLow << 1;
+            const ULOW cross_high = (lh.mHigh << 1) | (lh.mLow >> 63);
+            const ULOW cross_carry = lh.mHigh >> 63;
+            const ULOW middle = ll.mHigh + cross_low;
+            const ULOW carry = middle < cross_low;
+            ULOW high_low = hh.mLow + cross_high;
+            ULOW high_carry = high_low < cross_high;
+            high_low += carry;
+            high_carry += high_low < carry;
+            return std::make_pair(U128{ll.mLow, middle}, U128{high_low, hh.mHigh + high_carry + cross_carry});
         }
 
         /**
          * @brief Складывает два числа как беззнаковые по модулю 2^128.
          */
-        static U128 add_mod(U128 x, U128 y)
+        static constexpr U128 add_mod(U128 x, U128 y)
         {
             if (x.is_overflow() || y.is_overflow())
             {
@@ -492,17 +1213,15 @@ namespace u128
                 result.set_nan();
                 return result;
             }
-            const ULOW ac = x.mLow + y.mLow;
-            ULOW bd = x.mHigh + y.mHigh;
-            bd += ac < std::min(x.mLow, y.mLow) ? 1u : 0u;
-            U128 result{ac, bd};
+            U128 result{x.mLow, x.mHigh};
+            add_carry(result, y);
             return result;
         }
 
         /**
          * @brief Вычитает два числа как беззнаковые по модулю 2^128.
          */
-        static U128 sub_mod(U128 x, U128 y)
+        static constexpr U128 sub_mod(U128 x, U128 y)
         {
             if (x.is_overflow() || y.is_overflow())
             {
@@ -516,26 +1235,15 @@ namespace u128
                 result.set_nan();
                 return result;
             }
-            if (x >= y)
-            {
-                const ULOW ac = x.mLow - y.mLow;
-                ULOW bd = x.mHigh - y.mHigh;
-                bd -= x.mLow < y.mLow ? 1u : 0u;
-                U128 result{ac, bd};
-                return result;
-            }
-            else
-            {
-                y = U128::get_max_value() - y;
-                y.inc();
-                return add_mod(x, y);
-            }
+            U128 result{x.mLow, x.mHigh};
+            sub_borrow(result, y);
+            return result;
         }
 
         /**
          * y = (-x) mod 2^128.
          */
-        static U128 neg_mod(U128 x)
+        static constexpr U128 neg_mod(U128 x)
         {
             return sub_mod(U128{0}, x);
         }
@@ -543,7 +1251,7 @@ namespace u128
         /**
          * @brief Вычисляет произведение двух 128-битных чисел как беззнаковых по модулю 2^128.
          */
-        static U128 mult_mod(U128 x, U128 y)
+        static constexpr U128 mult_mod(U128 x, U128 y)
         {
             // x*y = (a + w*b)(c + w*d) = ac + w*(ad + bc) + w*w*bd = (ac + w*(ad + bc)) mod 2^128;
             if (x.is_overflow() || y.is_overflow())
@@ -558,16 +1266,10 @@ namespace u128
                 result.set_nan();
                 return result;
             }
-            const U128 ac = U128::mult64(x.mLow, y.mLow);
-            const U128 ad = U128::mult64(x.mLow, y.mHigh);
-            const U128 bc = U128::mult64(x.mHigh, y.mLow);
-            U128 result = add_mod(ad, bc);
-            result = shl64_mod(result);
-            result = add_mod(result, ac);
-            return result;
+            return mul_low(x, y);
         }
 
-        U128 operator*(ULOW rhs) const
+        constexpr U128 operator*(ULOW rhs) const
         {
             if (this->is_overflow()) {
                 U128 result;
@@ -583,15 +1285,29 @@ namespace u128
                 return U128{0};
             if (rhs == 0)
                 return U128{0};
+#ifdef U128_NATIVE
+            const UNATIVE low = static_cast<UNATIVE>(mLow) * rhs;
+            const UNATIVE high = static_cast<UNATIVE>(mHigh) * rhs + static_cast<ULOW>(low >> 64);
+            U128 result{static_cast<ULOW>(low), static_cast<ULOW>(high)};
+            result.mSingular.mOverflow = (high >> 64) != 0;
+#else
             U128 result = mult64(mLow, rhs);
             U128 tmp = mult64(mHigh, rhs);
             tmp = shl64(tmp);
             result += tmp;
+#endif
             result.mSign = !result.is_zero() ? this->mSign() : false;
             return result;
         }
 
-        U128 operator*(U128 rhs) const
+        template <std::signed_integral S>
+        constexpr U128 operator*(S y) const
+        {
+            const U128 &result = *this * magnitude(y);
+            return y < 0 && !result.is_zero() && !result.is_singular() ? -result : result;
+        }
+
+        constexpr U128 operator*(U128 rhs) const
         {
             const U128 X = *this;
             if (X.is_overflow() || rhs.is_overflow())
@@ -610,18 +1326,50 @@ namespace u128
                 return U128{0};
             if (rhs.is_zero())
                 return U128{0};
+#ifdef U128_NATIVE
+            // Одна из старших половинок обязана быть нулевой, иначе произведение не умещается в 128 бит.
+            const UNATIVE low = static_cast<UNATIVE>(X.mLow) * rhs.mLow;
+            const UNATIVE cross = static_cast<UNATIVE>(X.mLow) * rhs.mHigh + static_cast<UNATIVE>(X.mHigh) * rhs.mLow;
+            const UNATIVE high = cross + static_cast<ULOW>(low >> 64);
+            U128 result{static_cast<ULOW>(low), static_cast<ULOW>(high)};
+            result.mSingular.mOverflow = (X.mHigh != 0 && rhs.mHigh != 0) || (high >> 64) != 0;
+            result.mSign = this->mSign() ^ rhs.mSign();
+            return result;
+#else
             U128 result = X * rhs.mLow;
             if (result.is_singular())
             {
                 return result;
             }
-            result.mSign = this->mSign() ^ rhs.mSign();
             const auto tmp = X * rhs.mHigh;
-            result = result + shl64(tmp);
+            result = result + shl64(tmp); // Оба слагаемых со знаком X.
+            result.mSign = this->mSign() ^ rhs.mSign();
             return result;
+#endif
         }
 
-        U128 div10() const
+        /**
+         * @brief Квадрат числа. Результат неотрицателен.
+         * @details Ненулевая старшая половина дает переполнение, иначе - одно произведение 64x64.
+         */
+        constexpr U128 sqr() const
+        {
+            if (is_singular())
+            {
+                U128 result;
+                result.mSingular = mSingular;
+                return result;
+            }
+            if (mHigh != 0)
+            {
+                U128 result;
+                result.set_overflow();
+                return result;
+            }
+            return mult64(mLow, mLow);
+        }
+
+        constexpr U128 div10() const
         { // Специальный метод деления на 10 для формирования
             // строкового представления числа.
             U128 X = *this;
@@ -629,6 +1377,11 @@ namespace u128
             {
                 return X;
             }
+#ifdef U128_NATIVE
+            ULOW R;
+            const ULOW N = div128by64(X.mHigh % ULOW(10), X.mLow, ULOW(10), R);
+            return U128{N, X.mHigh / ULOW(10), X.mSign};
+#else
             const bool sign = X.mSign();
             X.mSign = false;
             ULOW Q = X.mHigh / ULOW(10);
@@ -650,9 +1403,10 @@ namespace u128
             }
             result.mSign = sign;
             return result;
+#endif
         }
 
-        int mod10() const
+        constexpr int mod10() const
         { // Специальный метод нахождения остатка от деления на 10 для формирования
             // строкового представления числа.
             if (this->is_singular())
@@ -663,11 +1417,193 @@ namespace u128
             return ((mLow % 10) + multiplier_mod10 * (mHigh % 10)) % 10;
         }
 
-        // Метод итеративного деления широкого числа на узкое.
+        /**
+         * @brief Деление 128-битного числа (high, low) на 64-битное.
+         * @details Требуется high < y: тогда частное умещается в 64 бита.
+         * На x86-64 со встроенным ядром выполняется одной инструкцией div.
+         * В переносимом ядре: алгоритм D Кнута с 32-битными цифрами, не более двух коррекций на цифру.
+         * @param remainder Остаток от деления.
+         * @return Частное.
+         */
+        static constexpr ULOW div128by64(ULOW high, ULOW low, ULOW y, ULOW &remainder)
+        {
+            assert(high < y);
+#if defined(U128_NATIVE) && defined(__x86_64__)
+            if (!std::is_constant_evaluated())
+            {
+                ULOW quotient;
+                asm("divq %[y]" : "=a"(quotient), "=d"(remainder) : [y] "rm"(y), "a"(low), "d"(high));
+                return quotient;
+            }
+#endif
+#if defined(U128_NATIVE)
+            const UNATIVE x = (static_cast<UNATIVE>(high) << 64) | low;
+            remainder = static_cast<ULOW>(x % y);
+            return static_cast<ULOW>(x / y);
+#else
+            constexpr ULOW b = ULOW(1) << mHalfWidth;
+            constexpr ULOW MASK = b - 1u;
+            const int s = std::countl_zero(y);
+            y <<= s; // Нормализация делителя: старший бит равен единице.
+            const ULOW vn1 = y >> mHalfWidth;
+            const ULOW vn0 = y & MASK;
+            const ULOW un32 = (high << s) | (s == 0 ? 0 : low >> (64 - s));
+            const ULOW un10 = low << s;
+            const ULOW un1 = un10 >> mHalfWidth;
+            const ULOW un0 = un10 & MASK;
+            ULOW q1 = un32 / vn1;
+            ULOW rhat = un32 - q1 * vn1;
+            while (q1 >= b || q1 * vn0 > b * rhat + un1)
+            {
+                q1--;
+                rhat += vn1;
+                if (rhat >= b)
+                    break;
+            }
+            const ULOW un21 = un32 * b + un1 - q1 * y;
+            ULOW q0 = un21 / vn1;
+            rhat = un21 - q0 * vn1;
+            while (q0 >= b || q0 * vn0 > b * rhat + un0)
+            {
+                q0--;
+                rhat += vn1;
+                if (rhat >= b)
+                    break;
+            }
+            remainder = (un21 * b + un0 - q0 * y) >> s;
+            return q1 * b + q0;
+#endif
+        }
+
+        /**
+         * @brief Деление беззнаковой части "в столбик" 64-битными цифрами на 64-битное число.
+         * @details Делится число remainder * 2^128 + |x|, требуется remainder < y.
+         * Частное записывается в x, знак и флаги не меняются.
+         * @return Остаток от деления.
+         */
+        static constexpr ULOW short_divmod(U128 &x, ULOW y, ULOW remainder = 0)
+        {
+            x.mHigh = div128by64(remainder, x.mHigh, y, remainder);
+            x.mLow = div128by64(remainder, x.mLow, y, remainder);
+            return remainder;
+        }
+
+        /**
+         * @brief Умножение беззнаковой части на 64-битное число со сложением: |x| = |x| * y + addend.
+         * @details Знак и флаги не меняются.
+         * @return Перенос: старшие 64 бита результата, не уместившиеся в 128 бит.
+         */
+        static constexpr ULOW mul_add_short(U128 &x, ULOW y, ULOW addend)
+        {
+            const U128 low = mult64(x.mLow, y);
+            const U128 high = mult64(x.mHigh, y);
+            x.mLow = low.mLow + addend;
+            ULOW carry = x.mLow < addend;
+            ULOW middle = low.mHigh + carry;
+            carry = middle < carry;
+            x.mHigh = middle + high.mLow;
+            carry += x.mHigh < high.mLow;
+            return high.mHigh + carry;
+        }
+
+        /**
+         * @brief Сложение беззнаковых частей с переносом: |x| = (|x| + |y| + carry) mod 2^128.
+         * @details Без проверок знаков и флагов; знак и флаги x не меняются.
+         * @return Перенос из старшего разряда: 0 или 1.
+         */
+        static constexpr ULOW add_carry(U128 &x, U128 y, ULOW carry = 0)
+        {
+#ifdef U128_NATIVE
+            const UNATIVE a = x.native();
+            UNATIVE sum = a + y.native();
+            ULOW out = sum < a;
+            sum += carry;
+            out += sum < carry;
+            x.mLow = static_cast<ULOW>(sum);
+            x.mHigh = static_cast<ULOW>(sum >> 64);
+            return out;
+#else
+            x.mLow += carry;
+            carry = x.mLow < carry;
+            x.mLow += y.mLow;
+            carry += x.mLow < y.mLow;
+            x.mHigh += carry;
+            carry = x.mHigh < carry;
+            x.mHigh += y.mHigh;
+            carry += x.mHigh < y.mHigh;
+            return carry;
+#endif
+        }
+
+        /**
+         * @brief Вычитание беззнаковых частей с заемом: |x| = (|x| - |y| - borrow) mod 2^128.
+         * @details Без проверок знаков и флагов; знак и флаги x не меняются.
+         * @return Заем из старшего разряда: 0 или 1.
+         */
+        static constexpr ULOW sub_borrow(U128 &x, U128 y, ULOW borrow = 0)
+        {
+#ifdef U128_NATIVE
+            const UNATIVE a = x.native();
+            const UNATIVE b = y.native();
+            const UNATIVE difference = a - b;
+            const ULOW out = (a < b) + (difference < borrow);
+            x.mLow = static_cast<ULOW>(difference - borrow);
+            x.mHigh = static_cast<ULOW>((difference - borrow) >> 64);
+            return out;
+#else
+            ULOW next = x.mLow < borrow;
+            x.mLow -= borrow;
+            next += x.mLow < y.mLow;
+            x.mLow -= y.mLow;
+            borrow = x.mHigh < next;
+            x.mHigh -= next;
+            borrow += x.mHigh < y.mHigh;
+            x.mHigh -= y.mHigh;
+            return borrow;
+#endif
+        }
+
+        /**
+         * @brief Младшие 128 бит произведения беззнаковых частей, без проверок знаков и флагов.
+         */
+        static constexpr U128 mul_low(const U128 &x, const U128 &y)
+        {
+#ifdef U128_NATIVE
+            return from_native(x.native() * y.native());
+#else
+            // От перекрестных произведений нужны только младшие половины.
+            U128 result = mult64(x.mLow, y.mLow);
+            result.mHigh += x.mLow * y.mHigh + x.mHigh * y.mLow;
+            return result;
+#endif
+        }
+
+        /**
+         * @brief Записывает беззнаковую часть в массив из mLimbs 64-битных слов, младшие слова - первыми.
+         */
+        static constexpr void store_limbs(const U128 &x, ULOW *limbs)
+        {
+            limbs[0] = x.mLow;
+            limbs[1] = x.mHigh;
+        }
+
+        /**
+         * @brief Читает беззнаковую часть из массива mLimbs 64-битных слов, младшие слова - первыми.
+         * @details Знак и флаги не меняются.
+         */
+        static constexpr void load_limbs(U128 &x, const ULOW *limbs)
+        {
+            x.mLow = limbs[0];
+            x.mHigh = limbs[1];
+        }
+
+        // Метод деления широкого числа на узкое. Частное округляется вниз, остаток неотрицателен.
+        // Во встроенном ядре: два аппаратных деления 128/64.
+        // В переносимом ядре: итеративный метод.
         // Наиболее вероятное количество итераций: ~N/4, где N - количество битов узкого числа.
         // В данном случае имеем ~64/4 = 16 итераций.
         // Максимум до ~(N+1) итерации.
-        std::pair<U128, U128> operator/(ULOW y) const
+        constexpr std::pair<U128, U128> operator/(ULOW y) const
         {
             assert(y != 0);
             const U128 X = *this;
@@ -675,6 +1611,18 @@ namespace u128
             {
                 return std::make_pair(X, U128{0});
             }
+#ifdef U128_NATIVE
+            ULOW R;
+            const ULOW N = div128by64(X.mHigh % y, X.mLow, y, R);
+            U128 result{N, X.mHigh / y, X.mSign};
+            if (X.mSign() && R != 0)
+            {
+                result.mLow += 1;
+                result.mHigh += result.mLow == 0;
+                R = y - R;
+            }
+            return std::make_pair(result, U128{R});
+#else
             ULOW Q = X.mHigh / y;
             ULOW R = X.mHigh % y;
             ULOW N = R * (mMaxULOW / y) + (X.mLow / y);
@@ -700,19 +1648,27 @@ namespace u128
                 E += tmp;
             }
             return std::make_pair(result, E);
+#endif
+        }
+
+        template <std::signed_integral S>
+        constexpr std::pair<U128, U128> operator/(S y) const
+        {
+            return y > 0 ? *this / static_cast<ULOW>(y) : *this / U128{magnitude(y), 0, Sign{y < 0}};
         }
 
-        std::pair<U128, U128> operator/=(ULOW y)
+        constexpr std::pair<U128, U128> operator/=(ULOW y)
         {
             U128 remainder;
             std::tie(*this, remainder) = *this / y;
             return std::make_pair(*this, remainder);
         }
 
-        // Метод деления двух широких чисел.
-        // Отсутствует "раскачка" алгоритма для "плохих" случаев деления: (A*M + B)/(1*M + D).
-        // Наиболее вероятное общее количество итераций: 4...6.
-        std::pair<U128, U128> operator/(const U128 other) const
+        // Метод деления двух широких чисел. Частное округляется вниз, остаток неотрицателен.
+        // Если старшая половина делителя ненулевая, то частное умещается в 64 бита и находится
+        // нормализованным делением 128/64 (алгоритм D Кнута для двух цифр) с единственной коррекцией:
+        // время деления не зависит от вида операндов.
+        constexpr std::pair<U128, U128> operator/(const U128 other) const
         {
             assert(!other.is_zero());
             U128 X = *this;
@@ -736,85 +1692,298 @@ namespace u128
                 return result;
             }
             const bool make_sign_inverse = X.mSign != Y.mSign;
-            X.mSign = make_sign_inverse;
-            Y.mSign = 0;
-            const ULOW Q = X.mHigh / Y.mHigh;
-            const ULOW R = X.mHigh % Y.mHigh;
-            const ULOW Delta = mMaxULOW - Y.mLow;
-            const U128 DeltaQ = mult64(Delta, Q);
-            U128 W1 = U128{0, R} - U128{0, Q};
-            W1 = W1 + DeltaQ;
-            const ULOW C1 = (Y.mHigh < mMaxULOW) ? Y.mHigh + ULOW(1) : mMaxULOW;
-            const ULOW W2 = mMaxULOW - Delta / C1;
-            auto [Quotient, _] = W1 / W2;
-            std::tie(Quotient, std::ignore) = Quotient / C1;
-            U128 result = U128{Q, 0} + Quotient;
-            if (make_sign_inverse)
-            {
-                result = -result;
-            }
-            U128 N = Y * result.mLow;
-            if (make_sign_inverse)
-            {
-                N = -N;
-            }
-            assert(!N.is_overflow());
-            U128 Error = X - N;
-            U128 More = Error - Y;
-            bool do_inc = More.is_nonegative();
-            bool do_dec = Error.is_negative();
-            while (do_dec || do_inc)
-            {
-                if (do_inc)
-                {
-                    result.inc();
-                    Error -= Y;
-                }
-                if (do_dec)
-                {
-                    result.dec();
-                    Error += Y;
-                }
-                More = Error - Y;
-                do_inc = More.is_nonegative();
-                do_dec = Error.is_negative();
+            X.mSign = false;
+            Y.mSign = false;
+            // Старшие 64 бита нормализованного делителя.
+            const int n = std::countl_zero(Y.mHigh);
+            const ULOW v1 = n == 0 ? Y.mHigh : (Y.mHigh << n) | (Y.mLow >> (64 - n));
+            // Сдвиг делимого гарантирует, что частное 128/64 умещается в 64 бита.
+            const U128 X1 = X >> 1;
+            ULOW R;
+            const ULOW Q1 = div128by64(X1.mHigh, X1.mLow, v1, R);
+            // Оценка частного меньше истинного не более чем на единицу.
+            ULOW Q = Q1 >> (63 - n);
+            Q -= Q != 0;
+            U128 Error = X - Y * Q;
+            if (Error >= Y)
+            {
+                Q++;
+                Error -= Y;
+            }
+            U128 result{Q, 0, make_sign_inverse};
+            if (make_sign_inverse && !Error.is_zero())
+            {
+                result.mLow++;
+                result.mHigh += result.mLow == 0;
+                Error = Y - Error;
             }
             return std::make_pair(result, Error);
         }
 
         /**
-         * Возвращает строковое представление числа.
+         * @brief Частное от деления, округленное вниз: то же, что (x / d).first.
+         * @details Для 64-битного делителя-степени двойки выполняется сдвигом, для 64-битных
+         * операндов - одним делением 64/64, для остальных 64-битных делителей - делением 128/64.
+         * Остаток отдельно не формируется.
          */
-        std::string value() const
+        static constexpr U128 div(const U128 &x, const U128 &d)
         {
-            std::string result{};
-            if (this->is_overflow())
+            assert(!d.is_zero());
+            if (x.is_singular() || d.is_singular() || d.mHigh != 0)
             {
-                result = INF;
-                return result;
+                return (x / d).first;
             }
-            if (this->is_nan())
+            const ULOW y = d.mLow;
+            const bool make_sign_inverse = x.mSign != d.mSign;
+            if ((y & (y - 1)) == 0)
             {
-                result = "";
+                U128 result = U128{x.mLow, x.mHigh} >> std::countr_zero(y);
+                if (make_sign_inverse && (x.mLow & (y - 1)) != 0)
+                {
+                    result.mLow++;
+                    result.mHigh += result.mLow == 0;
+                }
+                result.mSign = make_sign_inverse;
                 return result;
             }
-            U128 X = *this;
-            while (!X.is_zero())
+            if (x.mHigh == 0)
+            {
+                const ULOW q = x.mLow / y;
+                // Частное не больше 2^63, поэтому инкремент не дает переноса.
+                return U128{q + (make_sign_inverse && q * y != x.mLow), 0, make_sign_inverse};
+            }
+            ULOW r;
+            U128 result{div128by64(x.mHigh % y, x.mLow, y, r), x.mHigh / y, make_sign_inverse};
+            if (make_sign_inverse && r != 0)
             {
-                const int d = X.mod10();
-                if (d < 0)
+                result.mLow++;
+                result.mHigh += result.mLow == 0;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Остаток от деления, неотрицательный: то же, что (x / d).second.
+         * @details Для 64-битного делителя частное отдельно не формируется: маска для степени двойки,
+         * одно деление 64/64 или одно деление 128/64 для старшего остатка и младшей половины.
+         */
+        static constexpr U128 mod(const U128 &x, const U128 &d)
+        {
+            assert(!d.is_zero());
+            if (x.is_singular() || d.is_singular() || d.mHigh != 0)
+            {
+                return (x / d).second;
+            }
+            const ULOW y = d.mLow;
+            ULOW r;
+            if ((y & (y - 1)) == 0)
+            {
+                r = x.mLow & (y - 1);
+            }
+            else if (x.mHigh == 0)
+            {
+                r = x.mLow % y;
+            }
+            else
+            {
+                div128by64(x.mHigh % y, x.mLow, y, r);
+            }
+            if (x.mSign != d.mSign && r != 0)
+            {
+                r = y - r;
+            }
+            return U128{r};
+        }
+
+        /**
+         * @brief Остаток от деления 256-битного числа high * 2^128 + low на m: беззнаковые части, без флагов.
+         * @details 64-битный модуль - до четырех делений 128/64. Иначе - алгоритм D Кнута для двух цифр частного
+         * по 64 бита: оценка цифры делением 128/64, уточнение по второй цифре делителя и не более двух
+         * обратных сложений. Полное частное не формируется.
+         */
+        static constexpr U128 mod_wide(const U128 &low, U128 high, const U128 &m)
+        {
+            assert(!m.is_zero());
+            if (m.mHigh == 0)
+            {
+                const ULOW y = m.mLow;
+                ULOW r = 0;
+                if (high.mHigh != 0 || high.mLow != 0)
                 {
-                    return result;
+                    r = high.mHigh % y;
+                    div128by64(r, high.mLow, y, r);
                 }
-                result.push_back(DIGITS[d]);
-                X = X.div10();
+                div128by64(r, low.mHigh, y, r);
+                div128by64(r, low.mLow, y, r);
+                return U128{r};
+            }
+            if (high.mHigh > m.mHigh || (high.mHigh == m.mHigh && high.mLow >= m.mLow))
+            {
+                high = mod(U128{high.mLow, high.mHigh}, U128{m.mLow, m.mHigh});
+            }
+            // Нормализация: старший бит делителя равен единице. Старшая цифра делимого после сдвига - нулевая,
+            // так как high < m.
+            const int s = std::countl_zero(m.mHigh);
+            auto shl = [s](ULOW hi, ULOW lo) -> ULOW
+            {
+                return s == 0 ? hi : (hi << s) | (lo >> (64 - s));
+            };
+            const ULOW v1 = shl(m.mHigh, m.mLow);
+            const ULOW v0 = m.mLow << s;
+            ULOW u[4]{low.mLow << s, shl(low.mHigh, low.mLow), shl(high.mLow, low.mHigh), shl(high.mHigh, high.mLow)};
+            for (int j = 1; j >= 0; --j)
+            {
+                ULOW &u2 = u[j + 2];
+                ULOW &u1 = u[j + 1];
+                ULOW &u0 = u[j];
+                ULOW qhat = ~ULOW{0};
+                if (u2 < v1)
+                {
+                    ULOW rhat;
+                    qhat = div128by64(u2, u1, v1, rhat);
+                    // qhat * v0 > rhat * 2^64 + u0: оценка завышена.
+                    for (U128 p = mult64(qhat, v0); p.mHigh > rhat || (p.mHigh == rhat && p.mLow > u0);)
+                    {
+                        qhat--;
+                        const ULOW previous = rhat;
+                        rhat += v1;
+                        if (rhat < previous)
+                        {
+                            break;
+                        }
+                        p = mult64(qhat, v0);
+                    }
+                }
+                // (u2, u1, u0) -= qhat * (v1, v0).
+                const U128 p0 = mult64(qhat, v0);
+                const U128 p1 = mult64(qhat, v1);
+                const ULOW t1 = p1.mLow + p0.mHigh;
+                const ULOW t2 = p1.mHigh + (t1 < p1.mLow);
+                ULOW borrow = u0 < p0.mLow;
+                u0 -= p0.mLow;
+                ULOW next = (u1 < t1) | (u1 - t1 < borrow);
+                u1 = u1 - t1 - borrow;
+                borrow = next;
+                next = (u2 < t2) | (u2 - t2 < borrow);
+                u2 = u2 - t2 - borrow;
+                while (next != 0) // Отрицательный остаток: обратное сложение, пока не будет переноса из старшей цифры.
+                {
+                    u0 += v0;
+                    const ULOW carry0 = u0 < v0;
+                    const ULOW sum = u1 + v1;
+                    u1 = sum + carry0;
+                    const ULOW carry1 = (sum < v1) | (u1 < carry0);
+                    u2 += carry1;
+                    next = carry1 == 0 || u2 != 0;
+                }
+            }
+            return s == 0 ? U128{u[0], u[1]} : U128{(u[0] >> s) | (u[1] << (64 - s)), u[1] >> s};
+        }
+
+        /**
+         * @brief Остаток от деления на 64-битное число: то же, что mod(*this, U128{y}).mLow.
+         */
+        constexpr ULOW operator%(ULOW y) const
+        {
+            return mod(*this, U128{y}).mLow;
+        }
+
+        template <std::signed_integral S>
+        constexpr ULOW operator%(S y) const
+        {
+            return mod(*this, U128{magnitude(y), 0, Sign{y < 0}}).mLow;
+        }
+
+        /**
+         * @brief Делится ли x на d без остатка.
+         * @details Ранний выход без деления: у x меньше младших нулевых битов, чем у d,
+         * или |x| < |d|. Знаки операндов не влияют на результат.
+         */
+        static constexpr bool divides(const U128 &x, const U128 &d)
+        {
+            assert(!d.is_zero());
+            if (x.is_singular() || d.is_singular())
+            {
+                return false;
+            }
+            if (countr_zero(x) < countr_zero(d))
+            {
+                return false;
+            }
+            if (x.mHigh < d.mHigh || (x.mHigh == d.mHigh && x.mLow < d.mLow))
+            {
+                return x.mLow == 0 && x.mHigh == 0;
+            }
+            if (d.mHigh != 0)
+            {
+                return (x / d).second.is_zero();
+            }
+            const ULOW y = d.mLow;
+            if ((y & (y - 1)) == 0)
+            {
+                return true; // Уже проверено по младшим нулевым битам.
+            }
+            if (x.mHigh == 0)
+            {
+                return x.mLow % y == 0;
+            }
+            ULOW r;
+            div128by64(x.mHigh % y, x.mLow, y, r);
+            return r == 0;
+        }
+
+        /**
+         * @brief Обратный элемент нечетного числа по модулю 2^128: d * inv = 1 mod 2^128.
+         * @details Итерации Ньютона inv = inv * (2 - d * inv), каждая удваивает количество верных битов.
+         * Начальное приближение (3d) xor 2 верно в 5 младших битах: четыре итерации дают 64 бита, еще одна - 128.
+         * Последняя итерация упрощается: если d * inv = 1 + e * 2^64, то inv * (2 - d * inv) = inv - inv * e * 2^64.
+         */
+        static constexpr U128 inverse_mod_pow2(const U128 &d)
+        {
+            assert((d.mLow & 1) != 0);
+            ULOW inv = (3 * d.mLow) ^ 2;
+            for (int i = 0; i < 4; ++i)
+            {
+                inv *= 2 - d.mLow * inv;
             }
-            if (this->is_negative() && !this->is_zero())
+            const ULOW e = mult64(d.mLow, inv).mHigh + d.mHigh * inv;
+            return U128{inv, ULOW{0} - inv * e};
+        }
+
+        /**
+         * @brief Точное деление: x обязано делиться на d без остатка, иначе результат не определен.
+         * @details Деление заменяется умножением (Jebelean): младшие нулевые биты делителя сдвигаются,
+         * затем делимое умножается на обратный элемент нечетной части делителя по модулю 2^128.
+         * С U128_DEBUG_DIVEXACT делимость проверяется обратным умножением.
+         */
+        static constexpr U128 divexact(const U128 &x, const U128 &d)
+        {
+            assert(!d.is_zero());
+            if (x.is_singular() || d.is_singular())
             {
-                result.push_back('-');
+                return (x / d).first;
             }
-            std::reverse(result.begin(), result.end());
-            return result.length() != 0 ? result : "0";
+            const int s = countr_zero(d);
+            const U128 n = U128{x.mLow, x.mHigh} >> s;
+            const U128 odd = U128{d.mLow, d.mHigh} >> s;
+            U128 result = odd.mLow == 1 && odd.mHigh == 0 ? n : mult_mod(n, inverse_mod_pow2(odd));
+#ifdef U128_DEBUG_DIVEXACT
+            // Частное неделящегося x велико: произведение на d переполняется или не равно x.
+            assert((result * U128{d.mLow, d.mHigh} == U128{x.mLow, x.mHigh}));
+#endif
+            result.mSign = x.mSign != d.mSign;
+            return result;
+        }
+
+        /**
+         * Возвращает строковое представление числа.
+         * Цифры формируются порциями по 19 - делением на 10^19 - и записываются парами, см. to_chars.
+         */
+        constexpr std::string value() const
+        {
+            char buffer[40]; // Не более 39 цифр и знак.
+            const auto [end, _] = to_chars(buffer, buffer + sizeof(buffer), *this);
+            return std::string(buffer, end);
         }
 
         static constexpr U128 get_max_value()
@@ -829,9 +1998,9 @@ namespace u128
          * Сдвиг влево на 64 бита беззнаковой части по модулю 2^128.
          * Сохраняет знак.
          */
-        static U128 shl64_mod(U128 x)
+        static constexpr U128 shl64_mod(U128 x)
         { // sgn(x) * ( (|x| * 2^64) mod 2^128 )
-            U128 result{x.mHigh >> 1, x.mLow, x.mSign};
+            U128 result{0, x.mLow, x.mSign};
             result.mSingular = x.mSingular;
             return result;
         }
@@ -840,7 +2009,7 @@ namespace u128
          * Сдвиг влеово на 64 бита беззнаковой части.
          * Сохраняет знак. С переполнением.
          */
-        static U128 shl64(U128 x)
+        static constexpr U128 shl64(U128 x)
         { // x * 2^64
             U128 result{0, x.mLow, x.mSign};
             result.mSingular = x.mSingular;
@@ -850,5 +2019,126 @@ namespace u128
             }
             return result;
         }
+
+#ifdef U128_NATIVE
+        /**
+         * Беззнаковая часть числа во встроенном 128-битном типе.
+         */
+        constexpr UNATIVE native() const
+        {
+            return (static_cast<UNATIVE>(mHigh) << 64) | mLow;
+        }
+
+        /**
+         * Неотрицательное число из встроенного 128-битного типа.
+         */
+        static constexpr U128 from_native(UNATIVE x)
+        {
+            return U128{static_cast<ULOW>(x), static_cast<ULOW>(x >> 64)};
+        }
+#endif
     }; // struct U128
+
+    /**
+     * @brief Количество старших нулевых битов беззнаковой части: 128 для нуля.
+     */
+    constexpr int countl_zero(const U128 &x)
+    {
+        return x.mHigh != 0 ? std::countl_zero(x.mHigh) : 64 + std::countl_zero(x.mLow);
+    }
+
+    /**
+     * @brief Количество младших нулевых битов беззнаковой части: 128 для нуля.
+     */
+    constexpr int countr_zero(const U128 &x)
+    {
+        return x.mLow != 0 ? std::countr_zero(x.mLow) : 64 + std::countr_zero(x.mHigh);
+    }
+
+    /**
+     * @brief Количество единичных битов беззнаковой части.
+     */
+    constexpr int popcount(const U128 &x)
+    {
+        return std::popcount(x.mLow) + std::popcount(x.mHigh);
+    }
+
+    /**
+     * @brief Количество значащих битов беззнаковой части: 0 для нуля.
+     */
+    constexpr int bit_width(const U128 &x)
+    {
+        return 128 - countl_zero(x);
+    }
+
+    /**
+     * @brief Бит с номером i беззнаковой части числа, 0 <= i < 128.
+     */
+    constexpr bool test_bit(const U128 &x, int i)
+    {
+        return ((i < 64 ? x.mLow >> i : x.mHigh >> (i - 64)) & 1) != 0;
+    }
+
+    /**
+     * @brief Целая часть двоичного логарифма модуля числа: -1 для нуля.
+     */
+    template <typename T>
+    constexpr int log2_floor(const T &x)
+    {
+        return bit_width(x) - 1;
+    }
+
+    namespace literals
+    {
+        /**
+         * @brief Разбор целочисленного литерала при компиляции: десятичного, восьмеричного ("0..."),
+         * шестнадцатеричного ("0x...") или двоичного ("0b..."); разделители ' допускаются.
+         * @details Значение, не умещающееся в T, - ошибка компиляции.
+         */
+        template <typename T, char... Chars>
+        consteval T parse_literal()
+        {
+            constexpr char chars[]{Chars...};
+            constexpr std::size_t size = sizeof...(Chars);
+            int base = 10;
+            std::size_t i = 0;
+            if (size > 2 && chars[0] == '0' && (chars[1] == 'x' || chars[1] == 'X'))
+            {
+                base = 16;
+                i = 2;
+            }
+            else if (size > 2 && chars[0] == '0' && (chars[1] == 'b' || chars[1] == 'B'))
+            {
+                base = 2;
+                i = 2;
+            }
+            else if (size > 1 && chars[0] == '0')
+            {
+                base = 8;
+                i = 1;
+            }
+            char digits[size]{};
+            std::size_t n = 0;
+            for (; i < size; ++i)
+            {
+                if (chars[i] != '\'')
+                {
+                    digits[n++] = chars[i];
+                }
+            }
+            T result{0};
+            const auto [ptr, ec] = from_chars(digits, digits + n, result, base);
+            if (ec != std::errc{} || ptr != digits + n)
+            {
+                throw "Integer literal is out of range";
+            }
+            return result;
+        }
+
+        template <char... Chars>
+        consteval U128 operator""_u128()
+        {
+            return parse_literal<U128, Chars...>();
+        }
+    } // namespace literals
 } // namespace u128
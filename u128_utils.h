@@ -3,10 +3,17 @@
 #include "u128.hpp"
 #include <map>        // std::map
 #include <vector>     // std::vector
+#include <array>      // std::array
 #include <tuple>      // std::ignore, std::tie
 #include <utility>    // std::pair
 #include <functional> // std::function
+#include <cmath>      // std::sqrt
+#include <algorithm>  // std::min
+#include <type_traits> // std::decay_t
 #include "solver.hpp" // GaussJordan
+#include "packed_vector.hpp" // PackedVector
+#include "divisor.hpp" // Divisor
+#include "modular.hpp" // PlainModulus, Barrett, MontgomeryU128
 
 #include "gnumber.hpp" // GNumber
 
@@ -19,19 +26,36 @@ namespace u128
 {
     namespace utils
     {
+        // Нечетные простые числа до 7919: таблица вычисляется при компиляции.
+        static constexpr auto SMALL_PRIMES = []()
+        {
+            std::array<ULOW, 999> result{};
+            std::size_t n = 0;
+            for (ULOW x = 3; n < result.size(); x += 2)
+            {
+                bool is_prime = true;
+                for (std::size_t i = 0; is_prime && i < n && result[i] * result[i] <= x; ++i)
+                {
+                    is_prime = x % result[i] != 0;
+                }
+                if (is_prime)
+                {
+                    result[n++] = x;
+                }
+            }
+            return result;
+        }();
+
+        static_assert(SMALL_PRIMES.back() == 7919);
+
         /**
          * @brief Вычисляет положительную целочисленную степень x^y.
          * @param x Основание.
          * @param y Степень. Если степень отрицательная, то возвращает единицу.
          */
-        inline U128 int_power(ULOW x, int y)
+        constexpr U128 int_power(ULOW x, int y)
         {
-            U128 result{1};
-            for (int i = 1; i <= y; ++i)
-            {
-                result = result * x;
-            }
-            return result;
+            return pow(U128{x}, static_cast<ULOW>(std::max(y, 0)));
         }
 
         /**
@@ -41,13 +65,24 @@ namespace u128
          */
         inline int num_of_digits(U128 x)
         {
-            int i = 0;
-            while (!x.is_zero())
+            // Степени десяти до 10^38.
+            static constexpr auto POW10 = []()
             {
-                x = x.div10();
-                i++;
+                std::array<U128, 39> result;
+                result[0] = U128{1};
+                for (std::size_t i = 1; i < result.size(); ++i)
+                {
+                    result[i] = result[i - 1] * 10u;
+                }
+                return result;
+            }();
+            if (x.is_zero())
+            {
+                return 1;
             }
-            return i + (i == 0);
+            // floor(log2(x) * 1233 / 4096) меньше floor(log10(x)) не более чем на единицу.
+            const int digits = ((log2_floor(x) * 1233) >> 12) + 1;
+            return digits < static_cast<int>(POW10.size()) && x.abs() >= POW10[digits] ? digits + 1 : digits;
         }
 
         /**
@@ -69,7 +104,7 @@ namespace u128
                 while (!y.is_zero())
                 {
                     const T y_copy = y;
-                    y = (x / y).second;
+                    y = T::mod(x, y);
                     x = y_copy;
                 }
                 return x;
@@ -79,7 +114,7 @@ namespace u128
                 while (!x.is_zero())
                 {
                     const T x_copy = x;
-                    x = (y / x).second;
+                    x = T::mod(y, x);
                     y = x_copy;
                 }
                 return y;
@@ -88,6 +123,9 @@ namespace u128
 
         /**
          * Целочисленный квадратный корень.
+         * @details Начальное приближение - корень в double: для 64-битного числа он уже точен с
+         * точностью до единицы, для 128-битного - достаточно одной итерации Ньютона (одно деление 128/64)
+         * и одной коррекции.
          * @param exact Точно ли прошло извлечение корня.
          */
         inline U128 isqrt(U128 x, bool &exact)
@@ -97,40 +135,116 @@ namespace u128
             {
                 return x;
             }
-            const U128 c{ULOW(1) << U128::mHalfWidth, 0};
-            U128 result;
             x = x.abs();
-            if (x >= U128{0, 1})
+            if (x.mHigh == 0)
             {
-                result = c;
+                constexpr ULOW MAX_ROOT = 0xFFFFFFFFull;
+                ULOW r = std::min(static_cast<ULOW>(std::sqrt(static_cast<double>(x.mLow))), MAX_ROOT);
+                if (r * r > x.mLow)
+                    r--;
+                else if (r < MAX_ROOT && (r + 1) * (r + 1) <= x.mLow)
+                    r++;
+                exact = r * r == x.mLow;
+                return U128{r};
             }
-            else
+            // Относительная ошибка приближения ~2^-52: после шага Ньютона корень найден с точностью до единицы сверху.
+            const double estimate = std::sqrt(static_cast<double>(x.mHigh) * 0x1p64 + static_cast<double>(x.mLow));
+            const ULOW r0 = estimate >= 0x1p64 ? U128::get_max_value().mLow : static_cast<ULOW>(estimate);
+            U128 result = ((U128{r0} + (x / r0).first) / 2).first;
+            if (result.mHigh != 0 || U128::mult64(result.mLow, result.mLow) > x)
             {
-                result = U128{ULOW(1) << (U128::mHalfWidth / 2), 0};
+                result.dec();
             }
-            U128 prevprev = -U128{1};
-            U128 prev = x;
+            exact = U128::mult64(result.mLow, result.mLow) == x;
+            return result;
+        }
+
+        /**
+         * Целочисленный квадратный корень числа произвольной ширины.
+         * @details Приближение сверху строится корнем из старшей половины значащих битов (рекурсивно,
+         * вплоть до U128), после чего хватает одной-двух итераций Ньютона.
+         * @param exact Точно ли прошло извлечение корня.
+         */
+        template <typename L, unsigned int H>
+        inline GNumber<L, H> isqrt(GNumber<L, H> x, bool &exact)
+        {
+            using T = GNumber<L, H>;
+            exact = false;
+            if (x.is_singular())
+            {
+                return x;
+            }
+            x = x.abs();
+            if (x.mHigh.is_zero())
+            {
+                return T{isqrt(x.mLow, exact), L{0}};
+            }
+            // Четный сдвиг, после которого число умещается в младшую половину.
+            const int shift = (bit_width(x) - 2 * H + 1) & ~1;
+            [[maybe_unused]] bool is_exact;
+            const L top_root = isqrt((x >> shift).mLow, is_exact);
+            // sqrt(x) < (top_root + 1) * 2^(shift/2): итерации Ньютона убывают до корня.
+            T result = T{top_root, L{0}}.inc() << (shift / 2);
             for (;;)
             {
-                prevprev = prev;
-                prev = result;
-                const auto [tmp, remainder] = x / result;
-                std::tie(result, std::ignore) = (result + tmp) / 2;
-                if (result.is_zero())
-                {
-                    exact = true;
-                    return result;
-                }
-                if (result == prev)
-                {
-                    exact = (tmp == prev) && remainder.is_zero(); // Нет остатка от деления.
-                    return result;
-                }
-                if (result == prevprev)
+                const T next = ((result + T::div(x, result)) >> 1);
+                if (next >= result)
                 {
-                    return prev;
+                    break;
                 }
+                result = next;
             }
+            exact = result.sqr() == x;
+            return result;
+        }
+
+        /**
+         * @brief Младшие 64 бита беззнаковой части числа.
+         */
+        inline ULOW low_limb(const U128 &x)
+        {
+            return x.mLow;
+        }
+
+        template <typename L, unsigned int H>
+        inline ULOW low_limb(const GNumber<L, H> &x)
+        {
+            return low_limb(x.mLow);
+        }
+
+        /**
+         * @brief Остаток от деления беззнаковой части числа на 64-битное y: по одному делению 128/64 на цифру,
+         * от старших к младшим.
+         * @param r Остаток от старших цифр, r < y.
+         */
+        inline ULOW mod_small(const U128 &x, ULOW y, ULOW r = 0)
+        {
+            U128::div128by64(r, x.mHigh, y, r);
+            U128::div128by64(r, x.mLow, y, r);
+            return r;
+        }
+
+        template <typename L, unsigned int H>
+        inline ULOW mod_small(const GNumber<L, H> &x, ULOW y, ULOW r = 0)
+        {
+            return mod_small(x.mLow, y, mod_small(x.mHigh, y, r));
+        }
+
+        /**
+         * @brief Является ли число точным квадратом.
+         * @details Большинство чисел отсеивается без извлечения корня: квадраты дают лишь 12 вычетов по модулю 64.
+         */
+        template <typename T>
+        inline bool is_square(const T &x)
+        {
+            constexpr ULOW SQUARES_MOD_64 = 0x0202021202030213ull;
+            if (x.is_singular() || x.is_negative() || ((SQUARES_MOD_64 >> (low_limb(x) & 63)) & 1) == 0)
+            {
+                return false;
+            }
+            bool exact;
+            isqrt(x, exact);
+            return exact;
         }
 
         /**
@@ -142,12 +256,10 @@ namespace u128
         inline bool is_quadratiq_residue(U128 x, U128 p)
         {
             // y^2 = x mod p
-            auto [_, r1] = x / p;
+            const U128 r1 = U128::mod(x, p);
             for (U128 y{0}; y < p; y.inc())
             {
-                U128 sq = y * y;
-                auto [_, r2] = sq / p;
-                if (r2 == r1)
+                if (U128::mod(y.sqr(), p) == r1)
                     return true;
             }
             return false;
@@ -165,12 +277,10 @@ namespace u128
             // return  sqrt(x) mod p
             U128 result[2];
             int idx = 0;
-            const auto [_, r1] = x / p;
+            const U128 r1 = U128::mod(x, p);
             for (U128 y{0}; y < p; y.inc())
             {
-                U128 sq = y * y;
-                auto [_, r2] = sq / p;
-                if (r2 == r1)
+                if (U128::mod(y.sqr(), p) == r1)
                     result[idx++] = y;
             }
             if (idx == 1)
@@ -180,19 +290,201 @@ namespace u128
             return std::make_pair(result[0], result[1]);
         }
 
+        /**
+         * @brief Символ Якоби (a/n) для нечетного n: алгоритм Евклида с законом взаимности.
+         */
+        inline int jacobi(ULOW a, ULOW n)
+        {
+            int t = 1;
+            a %= n;
+            while (a != 0)
+            {
+                const int z = std::countr_zero(a);
+                a >>= z;
+                if ((z & 1) && ((n & 7) == 3 || (n & 7) == 5))
+                    t = -t;
+                if ((a & 3) == 3 && (n & 3) == 3)
+                    t = -t;
+                std::swap(a, n);
+                a %= n;
+            }
+            return n == 1 ? t : 0;
+        }
+
+        /**
+         * @brief Символ Якоби (a/n) для небольшого знакового a и нечетного n > 0 любой ширины.
+         * @details После закона взаимности остается остаток n по 64-битному модулю: деления
+         * полноразрядного числа нет.
+         */
+        template <typename T>
+        inline int jacobi(int64_t a, const T &n)
+        {
+            const ULOW n_low = low_limb(n);
+            int t = a < 0 && (n_low & 3) == 3 ? -1 : 1; // (-1/n).
+            ULOW b = U128::magnitude(a);
+            if (b == 0)
+            {
+                return n == T{1} ? 1 : 0;
+            }
+            const int z = std::countr_zero(b);
+            b >>= z;
+            if ((z & 1) && ((n_low & 7) == 3 || (n_low & 7) == 5))
+                t = -t;
+            if ((b & 3) == 3 && (n_low & 3) == 3)
+                t = -t;
+            return t * jacobi(mod_small(n, b), b);
+        }
+
+        /**
+         * @brief Сильный тест Миллера-Рабина по основанию base.
+         * @param d Нечетная часть n - 1 = d * 2^s.
+         * @return false, если n заведомо составное.
+         */
+        template <typename Context, typename T>
+        inline bool miller_rabin(const Context &ctx, const T &d, int s, const T &base)
+        {
+            const T one = ctx.one();
+            const T minus_one = ctx.sub(T{0}, one);
+            T x = pow(ctx, ctx.to(base), d);
+            if (x == one || x == minus_one)
+                return true;
+            for (int r = 1; r < s; ++r)
+            {
+                x = ctx.sqr(x);
+                if (x == minus_one)
+                    return true;
+                if (x == one)
+                    return false;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Сильный тест Люка с параметрами Селфриджа: P = 1, Q = (1 - D) / 4, где D - первое
+         * из 5, -7, 9, -11, ..., для которого (D/n) = -1.
+         * @param ctx Контекст по модулю n - нечетному числу, не являющемуся точным квадратом и не делящемуся на малые простые.
+         * @return false, если n заведомо составное.
+         */
+        template <typename Context>
+        inline bool strong_lucas(const Context &ctx)
+        {
+            using T = std::decay_t<decltype(ctx.modulus())>;
+            const T &n = ctx.modulus();
+            int64_t D = 5;
+            for (;; D = D > 0 ? -(D + 2) : 2 - D)
+            {
+                const int j = jacobi(D, n);
+                if (j == -1)
+                    break;
+                if (j == 0)
+                    return n == T{U128::magnitude(D)};
+            }
+            // n + 1 = d * 2^s; n < 2^W - 1, так как 2^W - 1 делится на 3.
+            T d = n;
+            d.inc();
+            const int s = countr_zero(d);
+            d = d >> s;
+            const T q = to_context(ctx, (1 - D) / 4);
+            const T delta = to_context(ctx, D);
+            T u = ctx.one(); // U_1.
+            T v = ctx.one(); // V_1 = P.
+            T qk = q;        // Q^1.
+            for (int i = bit_width(d) - 2; i >= 0; --i)
+            {
+                // k -> 2k: U_2k = U_k * V_k, V_2k = V_k^2 - 2 * Q^k.
+                u = ctx.mul(u, v);
+                v = ctx.sub(ctx.sqr(v), ctx.add(qk, qk));
+                qk = ctx.sqr(qk);
+                if (test_bit(d, i))
+                { // k -> k + 1: U = (P * U + V) / 2, V = (D * U + P * V) / 2.
+                    const T u_next = half(ctx, ctx.add(u, v));
+                    v = half(ctx, ctx.add(ctx.mul(delta, u), v));
+                    u = u_next;
+                    qk = ctx.mul(qk, q);
+                }
+            }
+            if (u.is_zero() || v.is_zero())
+                return true;
+            for (int r = 1; r < s; ++r)
+            {
+                v = ctx.sub(ctx.sqr(v), ctx.add(qk, qk));
+                if (v.is_zero())
+                    return true;
+                qk = ctx.sqr(qk);
+            }
+            return false;
+        }
+
+        /**
+         * @brief Является ли модуль числа простым.
+         * @details Пробное деление на малые простые, затем сильный тест Миллера-Рабина по 13 первым простым
+         * основаниям: он детерминирован для чисел меньше psi_13 ~ 3.3 * 10^24. Для больших чисел
+         * дополнительно выполняется сильный тест Люка (тест Baillie-PSW): контрпримеры к нему неизвестны.
+         * Как и прежде, 0 и 1 не отвергаются: factor возвращает их как единственный "множитель".
+         */
         inline bool is_prime(U128 x)
         {
-            [[maybe_unused]] bool exact;
-            const auto x_sqrt = isqrt(x, exact) + U128{1};
-            U128 d{2, 0};
-            bool is_ok = true;
-            while (d < x_sqrt)
+            constexpr int TRIAL_PRIMES = 64;
+            constexpr U128 PSI_13{0x51adc5b22410a5fdull, 0x2be69ull}; // 3317044064679887385961981.
+            x = x.abs();
+            if (x.is_singular())
+                return false;
+            if (x < 2)
+                return true;
+            if ((x.mLow & 1) == 0)
+                return x == 2;
+            for (int i = 0; i < TRIAL_PRIMES; ++i)
+            {
+                const ULOW p = SMALL_PRIMES[i];
+                if (x == p)
+                    return true;
+                if (x % p == 0)
+                    return false;
+            }
+            if (x < SMALL_PRIMES[TRIAL_PRIMES] * SMALL_PRIMES[TRIAL_PRIMES])
+                return true;
+            const MontgomeryU128 ctx{x};
+            U128 d = x - 1u;
+            const int s = countr_zero(d);
+            d = d >> s;
+            if (!miller_rabin(ctx, d, s, U128{2}))
+                return false;
+            for (int i = 0; i < 12; ++i)
             {
-                auto [_, remainder] = x / d;
-                is_ok &= !remainder.is_zero();
-                d.inc();
+                if (!miller_rabin(ctx, d, s, U128{SMALL_PRIMES[i]}))
+                    return false;
             }
-            return is_ok;
+            return x < PSI_13 || (!is_square(x) && strong_lucas(ctx));
+        }
+
+        /**
+         * @brief Тест Baillie-PSW для числа любой ширины: пробное деление на малые простые, сильный тест
+         * Миллера-Рабина по основанию 2 и сильный тест Люка. Контрпримеры к тесту неизвестны.
+         * @details Остатки по малым простым находятся по 64-битным цифрам, без деления полноразрядного числа.
+         */
+        template <typename T>
+        inline bool is_probable_prime(T x)
+        {
+            constexpr int TRIAL_PRIMES = 256;
+            x = x.abs();
+            if (x.is_singular() || x < T{2})
+                return false;
+            if ((low_limb(x) & 1) == 0)
+                return x == T{2};
+            for (int i = 0; i < TRIAL_PRIMES; ++i)
+            {
+                const ULOW p = SMALL_PRIMES[i];
+                if (mod_small(x, p) == 0)
+                    return x == T{p};
+            }
+            if (x < T{SMALL_PRIMES[TRIAL_PRIMES] * SMALL_PRIMES[TRIAL_PRIMES]})
+                return true;
+            const PlainModulus<T> ctx{x};
+            T d = x;
+            d.dec();
+            const int s = countr_zero(d);
+            d = d >> s;
+            return miller_rabin(ctx, d, s, T{2}) && !is_square(x) && strong_lucas(ctx);
         }
 
         class PrimesGenerator
@@ -212,8 +504,7 @@ namespace u128
                     last_prime.inc();
                     for (const auto &p : mPrimes)
                     {
-                        U128 rem = (last_prime / p).second;
-                        if (rem.is_zero())
+                        if (U128::divides(last_prime, p))
                         {
                             is_prime = false;
                             break;
@@ -239,13 +530,14 @@ namespace u128
          */
         inline std::pair<U128, int> div_by_q(U128 &x, ULOW q)
         {
-            auto [tmp, remainder] = x / q;
+            const Divisor<ULOW> divisor{q};
+            auto [tmp, remainder] = divisor.divmod(x);
             int i = 0;
             while (remainder.is_zero())
             {
                 i++;
                 x = tmp;
-                std::tie(tmp, remainder) = x / q;
+                std::tie(tmp, remainder) = divisor.divmod(x);
             }
             return std::make_pair(U128{q, 0}, i);
         }
@@ -259,15 +551,15 @@ namespace u128
                 if (is_exact)
                     return std::make_pair(x_sqrt, x_sqrt);
             }
-            const auto error = x - x_sqrt * x_sqrt;
-            auto y = U128{2, 0} * x_sqrt + U128{1} - error;
+            const auto error = x - x_sqrt.sqr();
+            auto y = x_sqrt * 2 + 1 - error;
             {
                 bool is_exact;
                 auto y_sqrt = isqrt(y, is_exact);
-                const auto delta = x_sqrt + x_sqrt + U128{3, 0};
+                const auto delta = x_sqrt + x_sqrt + 3;
                 y = y + delta;
                 if (is_exact)
-                    return std::make_pair(x_sqrt + U128{1} - y_sqrt, x_sqrt + U128{1} + y_sqrt);
+                    return std::make_pair(x_sqrt + 1 - y_sqrt, x_sqrt + 1 + y_sqrt);
             }
             const auto &k_upper = x_sqrt;
             for (auto k = U128{2, 0};; k.inc())
@@ -280,10 +572,10 @@ namespace u128
                 { // Проверка с другой стороны: ускоряет поиск.
                     // Основано на равенстве, следующем из метода Ферма: индекс k = (F^2 + x) / (2F) - floor(sqrt(x)).
                     // Здесь F - кандидат в множители, x - раскладываемое число.
-                    const auto &N1 = k * k + x;
+                    const auto &N1 = k.sqr() + x;
                     if ((N1.mLow % 2) == 0)
                     {
-                        auto [q1, remainder] = N1 / (k + k); // Здесь k как некоторый множитель F.
+                        const auto &[q1, remainder] = N1 / (k + k); // Здесь k как некоторый множитель F.
                         if (remainder.is_zero() && (q1 > x_sqrt))
                         {
                             auto [q2, remainder] = x / k;
@@ -296,7 +588,7 @@ namespace u128
                     continue;
                 bool is_exact;
                 const auto y_sqrt = isqrt(y, is_exact);
-                const auto delta = (x_sqrt + x_sqrt) + (k + k) + U128{1};
+                const auto delta = (x_sqrt + x_sqrt) + (k + k) + 1;
                 y = y + delta;
                 if (!is_exact)
                     continue;
@@ -326,18 +618,18 @@ namespace u128
                 const auto& [p, i] = div_by_q(x, 2);
                 if (i > 0)
                     result[p] = i;
-                if (x < U128{2, 0})
+                if (x < 2)
                 {
                     return result;
                 }
             }
             // Делим на простые из списка: опционально.
-            for (const auto &el : std::vector{3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509, 521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829, 839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163, 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283, 1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427, 1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511, 1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619, 1621, 1627, 1637, 1657, 1663, 1667, 1669, 1693, 1697, 1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753, 1759, 1777, 1783, 1787, 1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879, 1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987, 1993, 1997, 1999, 2003, 2011, 2017, 2027, 2029, 2039, 2053, 2063, 2069, 2081, 2083, 2087, 2089, 2099, 2111, 2113, 2129, 2131, 2137, 2141, 2143, 2153, 2161, 2179, 2203, 2207, 2213, 2221, 2237, 2239, 2243, 2251, 2267, 2269, 2273, 2281, 2287, 2293, 2297, 2309, 2311, 2333, 2339, 2341, 2347, 2351, 2357, 2371, 2377, 2381, 2383, 2389, 2393, 2399, 2411, 2417, 2423, 2437, 2441, 2447, 2459, 2467, 2473, 2477, 2503, 2521, 2531, 2539, 2543, 2549, 2551, 2557, 2579, 2591, 2593, 2609, 2617, 2621, 2633, 2647, 2657, 2659, 2663, 2671, 2677, 2683, 2687, 2689, 2693, 2699, 2707, 2711, 2713, 2719, 2729, 2731, 2741, 2749, 2753, 2767, 2777, 2789, 2791, 2797, 2801, 2803, 2819, 2833, 2837, 2843, 2851, 2857, 2861, 2879, 2887, 2897, 2903, 2909, 2917, 2927, 2939, 2953, 2957, 2963, 2969, 2971, 2999, 3001, 3011, 3019, 3023, 3037, 3041, 3049, 3061, 3067, 3079, 3083, 3089, 3109, 3119, 3121, 3137, 3163, 3167, 3169, 3181, 3187, 3191, 3203, 3209, 3217, 3221, 3229, 3251, 3253, 3257, 3259, 3271, 3299, 3301, 3307, 3313, 3319, 3323, 3329, 3331, 3343, 3347, 3359, 3361, 3371, 3373, 3389, 3391, 3407, 3413, 3433, 3449, 3457, 3461, 3463, 3467, 3469, 3491, 3499, 3511, 3517, 3527, 3529, 3533, 3539, 3541, 3547, 3557, 3559, 3571, 3581, 3583, 3593, 3607, 3613, 3617, 3623, 3631, 3637, 3643, 3659, 3671, 3673, 3677, 3691, 3697, 3701, 3709, 3719, 3727, 3733, 3739, 3761, 3767, 3769, 3779, 3793, 3797, 3803, 3821, 3823, 3833, 3847, 3851, 3853, 3863, 3877, 3881, 3889, 3907, 3911, 3917, 3919, 3923, 3929, 3931, 3943, 3947, 3967, 3989, 4001, 4003, 4007, 4013, 4019, 4021, 4027, 4049, 4051, 4057, 4073, 4079, 4091, 4093, 4099, 4111, 4127, 4129, 4133, 4139, 4153, 4157, 4159, 4177, 4201, 4211, 4217, 4219, 4229, 4231, 4241, 4243, 4253, 4259, 4261, 4271, 4273, 4283, 4289, 4297, 4327, 4337, 4339, 4349, 4357, 4363, 4373, 4391, 4397, 4409, 4421, 4423, 4441, 4447, 4451, 4457, 4463, 4481, 4483, 4493, 4507, 4513, 4517, 4519, 4523, 4547, 4549, 4561, 4567, 4583, 4591, 4597, 4603, 4621, 4637, 4639, 4643, 4649, 4651, 4657, 4663, 4673, 4679, 4691, 4703, 4721, 4723, 4729, 4733, 4751, 4759, 4783, 4787, 4789, 4793, 4799, 4801, 4813, 4817, 4831, 4861, 4871, 4877, 4889, 4903, 4909, 4919, 4931, 4933, 4937, 4943, 4951, 4957, 4967, 4969, 4973, 4987, 4993, 4999, 5003, 5009, 5011, 5021, 5023, 5039, 5051, 5059, 5077, 5081, 5087, 5099, 5101, 5107, 5113, 5119, 5147, 5153, 5167, 5171, 5179, 5189, 5197, 5209, 5227, 5231, 5233, 5237, 5261, 5273, 5279, 5281, 5297, 5303, 5309, 5323, 5333, 5347, 5351, 5381, 5387, 5393, 5399, 5407, 5413, 5417, 5419, 5431, 5437, 5441, 5443, 5449, 5471, 5477, 5479, 5483, 5501, 5503, 5507, 5519, 5521, 5527, 5531, 5557, 5563, 5569, 5573, 5581, 5591, 5623, 5639, 5641, 5647, 5651, 5653, 5657, 5659, 5669, 5683, 5689, 5693, 5701, 5711, 5717, 5737, 5741, 5743, 5749, 5779, 5783, 5791, 5801, 5807, 5813, 5821, 5827, 5839, 5843, 5849, 5851, 5857, 5861, 5867, 5869, 5879, 5881, 5897, 5903, 5923, 5927, 5939, 5953, 5981, 5987, 6007, 6011, 6029, 6037, 6043, 6047, 6053, 6067, 6073, 6079, 6089, 6091, 6101, 6113, 6121, 6131, 6133, 6143, 6151, 6163, 6173, 6197, 6199, 6203, 6211, 6217, 6221, 6229, 6247, 6257, 6263, 6269, 6271, 6277, 6287, 6299, 6301, 6311, 6317, 6323, 6329, 6337, 6343, 6353, 6359, 6361, 6367, 6373, 6379, 6389, 6397, 6421, 6427, 6449, 6451, 6469, 6473, 6481, 6491, 6521, 6529, 6547, 6551, 6553, 6563, 6569, 6571, 6577, 6581, 6599, 6607, 6619, 6637, 6653, 6659, 6661, 6673, 6679, 6689, 6691, 6701, 6703, 6709, 6719, 6733, 6737, 6761, 6763, 6779, 6781, 6791, 6793, 6803, 6823, 6827, 6829, 6833, 6841, 6857, 6863, 6869, 6871, 6883, 6899, 6907, 6911, 6917, 6947, 6949, 6959, 6961, 6967, 6971, 6977, 6983, 6991, 6997, 7001, 7013, 7019, 7027, 7039, 7043, 7057, 7069, 7079, 7103, 7109, 7121, 7127, 7129, 7151, 7159, 7177, 7187, 7193, 7207, 7211, 7213, 7219, 7229, 7237, 7243, 7247, 7253, 7283, 7297, 7307, 7309, 7321, 7331, 7333, 7349, 7351, 7369, 7393, 7411, 7417, 7433, 7451, 7457, 7459, 7477, 7481, 7487, 7489, 7499, 7507, 7517, 7523, 7529, 7537, 7541, 7547, 7549, 7559, 7561, 7573, 7577, 7583, 7589, 7591, 7603, 7607, 7621, 7639, 7643, 7649, 7669, 7673, 7681, 7687, 7691, 7699, 7703, 7717, 7723, 7727, 7741, 7753, 7757, 7759, 7789, 7793, 7817, 7823, 7829, 7841, 7853, 7867, 7873, 7877, 7879, 7883, 7901, 7907, 7919})
+            for (const auto &el : SMALL_PRIMES)
             {
                 const auto& [p, i] = div_by_q(x, el);
                 if (i > 0)
                     result[p] = i;
-                if (x < U128{2, 0})
+                if (x < 2)
                 {
                     return result;
                 }
@@ -347,12 +639,12 @@ namespace u128
             ferma_recursive = [&ferma_recursive, &result](U128 x) -> void
             {
                 const auto& [a, b] = ferma_method(x);
-                if (a == U128{1, 0})
+                if (a == 1)
                 {
                     result[b]++;
                     return;
                 }
-                else if (b == U128{1, 0})
+                else if (b == 1)
                 {
                     result[a]++;
                     return;
@@ -405,6 +697,11 @@ namespace u128
                     }
                 }
                 // std::cout << "Factor base: size: " << base.size() << std::endl;
+                std::vector<Divisor<ULOW>> base_divisors;
+                for (const U128 &p : base)
+                {
+                    base_divisors.emplace_back(p.mLow);
+                }
                 bool is_exact;
                 U128 x_sqrt = isqrt(x, is_exact);
                 if (!is_exact)
@@ -413,26 +710,28 @@ namespace u128
                 }
                 const auto& x_sqrt_ext = convert_u128_to_ext(x_sqrt);
                 // std::cout << "Sqrt(x): " << x_sqrt.value() << std::endl;
-                std::vector<U128> sieve(sieve_size);
+                PackedVector sieve(sieve_size);
                 U128 ii{0};
                 // std::cout << "Sieve: \n";
                 for (unsigned int i = 0; i < sieve.size(); ++i)
                 {
-                    sieve[i] = (ii + x_sqrt) * (ii + x_sqrt) - x;
+                    sieve.set(i, (ii + x_sqrt).sqr() - x);
                     // std::cout << sieve.at(i).value() << ", ";
                     ii.inc();
                 }
                 // std::cout << std::endl;
-                std::vector<U128> sieve_original = sieve;
-                for (const U128 &modulo : base)
+                PackedVector sieve_original = sieve;
+                for (unsigned int i = 0; i < base.size(); ++i)
                 {
+                    const U128 &modulo = base[i];
+                    const Divisor<ULOW> &divisor = base_divisors[i];
                     auto [root_1, root_2] = sqrt_mod(x, modulo);
                     // std::cout << "Sqrts pre: " << root_1.value() << ", " << root_2.value() << ", modulo: " << modulo.mLow << std::endl;
                     root_1 -= x_sqrt;
                     root_2 -= x_sqrt;
                     if (root_1.is_negative())
                     {
-                        U128 delta_1 = (root_1.abs() / modulo).first;
+                        U128 delta_1 = U128::div(root_1.abs(), modulo);
                         root_1 += delta_1 * modulo;
                     }
                     if (root_1.is_negative())
@@ -441,7 +740,7 @@ namespace u128
                     }
                     if (root_2.is_negative())
                     {
-                        U128 delta_2 = (root_2.abs() / modulo).first;
+                        U128 delta_2 = U128::div(root_2.abs(), modulo);
                         root_2 += delta_2 * modulo;
                     }
                     if (root_2.is_negative())
@@ -452,7 +751,7 @@ namespace u128
                     unsigned int idx = root_1.mLow;
                     while ((idx + 1) < sieve.size())
                     {
-                        sieve[idx] = (sieve.at(idx) / modulo).first;
+                        sieve.set(idx, divisor.div(sieve.at(idx)));
                         idx += modulo.mLow;
                     }
                     if (root_1 != root_2)
@@ -460,7 +759,7 @@ namespace u128
                         unsigned int idx = root_2.mLow;
                         while ((idx + 1) < sieve.size())
                         {
-                            sieve[idx] = (sieve.at(idx) / modulo).first;
+                            sieve.set(idx, divisor.div(sieve.at(idx)));
                             idx += modulo.mLow;
                         }
                     }
@@ -486,10 +785,9 @@ namespace u128
                     M.push_back({});
                     const U128 &value = sieve_original.at(index);
                     sieve_reduced.push_back(value);
-                    for (const U128 &modulo : base)
+                    for (const auto &divisor : base_divisors)
                     {
-                        const auto &[_, r] = value / modulo;
-                        M[idx].push_back(r.is_zero() ? 1 : 0);
+                        M[idx].push_back(divisor.divides(value) ? 1 : 0);
                     }
                     idx++;
                 }
@@ -527,10 +825,9 @@ namespace u128
                         {
                             const auto &val = sieve_reduced.at(*it);
                             // std::cout << "val: " << val.value() << ", index: " << index << std::endl;
-                            for (const auto &modulo : base)
+                            for (const auto &divisor : base_divisors)
                             {
-                                auto rem = (val / modulo).second;
-                                sieve_factors[modulo] += rem.is_zero() ? 1 : 0;
+                                sieve_factors[U128{divisor.divisor()}] += divisor.divides(val) ? 1 : 0;
                             }
                         }
                         // std::cout << "A: " << std::flush << A.value() << std::endl;
@@ -553,10 +850,7 @@ namespace u128
                     Uext B{1};
                     for (const auto &[prime, power] : B_factors)
                     {
-                        Uext tmp{1};
-                        for (int i = 0; i < power; ++i)
-                            tmp = tmp * prime;
-                        B = B * tmp;
+                        B = B * pow(prime, static_cast<ULOW>(power));
                     }
                     // std::cout << "B: " << B.value() << std::endl;
                     const auto& x_ext = convert_u128_to_ext(x);
@@ -595,7 +889,7 @@ namespace u128
                 {
                     y = divisor1;
                 }
-                x = (x / divisor1).first;
+                x = U128::divexact(x, divisor1);
             }
             return result;
         }